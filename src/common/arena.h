@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/types.h"
+
+namespace Common {
+
+/**
+ * Bump-pointer allocator that owns everything allocated from it until Reset is called.
+ * Destructors of the objects created in the arena are never run, so those objects must keep
+ * all of their memory in the arena as well, see ArenaAllocator.
+ */
+class Arena {
+public:
+    explicit Arena(size_t block_size_ = 64_KB) : block_size{block_size_} {
+        NewBlock(block_size);
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment) {
+        const uintptr_t ptr = (cursor + alignment - 1) & ~(alignment - 1);
+        if (ptr + size > end) [[unlikely]] {
+            return AllocateSlow(size, alignment);
+        }
+        cursor = ptr + size;
+        return reinterpret_cast<void*>(ptr);
+    }
+
+    template <typename T, typename... Args>
+        requires std::is_constructible_v<T, Args...>
+    [[nodiscard]] T* Create(Args&&... args) {
+        void* const memory = Allocate(sizeof(T), alignof(T));
+        return std::construct_at(static_cast<T*>(memory), std::forward<Args>(args)...);
+    }
+
+    /// Releases every allocation at once.
+    void Reset() {
+        if (blocks.size() > 1) {
+            // The arena outgrew its first block, squash the next round into a single one
+            size_t total_size{};
+            for (const auto& block : blocks) {
+                total_size += block.size;
+            }
+            blocks.clear();
+            NewBlock(total_size);
+        } else {
+            cursor = reinterpret_cast<uintptr_t>(blocks.front().data.get());
+        }
+    }
+
+private:
+    struct Block {
+        std::unique_ptr<u8[]> data;
+        size_t size;
+    };
+
+    void NewBlock(size_t size) {
+        auto& block = blocks.emplace_back(std::make_unique_for_overwrite<u8[]>(size), size);
+        cursor = reinterpret_cast<uintptr_t>(block.data.get());
+        end = cursor + size;
+    }
+
+    void* AllocateSlow(size_t size, size_t alignment) {
+        NewBlock(std::max(block_size, size + alignment));
+        return Allocate(size, alignment);
+    }
+
+    std::vector<Block> blocks;
+    uintptr_t cursor{};
+    uintptr_t end{};
+    size_t block_size{};
+};
+
+/// Standard allocator that takes its memory from an arena. Deallocation is a no-op.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    ArenaAllocator(Arena& arena_) noexcept : arena{&arena_} {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena{other.arena} {}
+
+    [[nodiscard]] T* allocate(size_t n) {
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    Arena* arena;
+};
+
+} // namespace Common
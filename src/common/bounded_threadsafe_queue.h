@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -245,4 +246,83 @@ private:
     std::mutex read_mutex;
 };
 
+/**
+ * Lock-free bounded queue for any number of producers and consumers, after Dmitry Vyukov's
+ * design. Each slot carries a sequence number telling whether it is free for the producer or
+ * ready for the consumer of the current lap. Neither side blocks, callers that need to wait pair
+ * the queue with a semaphore. TryPop may fail while a producer that claimed an earlier slot is
+ * still writing it, even if a later slot is already published.
+ */
+template <typename T, std::size_t Capacity = detail::DefaultCapacity>
+class BoundedMPMCQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+    BoundedMPMCQueue() {
+        for (std::size_t i = 0; i < Capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order::relaxed);
+        }
+    }
+
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        std::size_t pos = m_write_index.load(std::memory_order::relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos % Capacity];
+            const std::size_t sequence = cell->sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (m_write_index.compare_exchange_weak(pos, pos + 1,
+                                                        std::memory_order::relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The slot still holds an element of the previous lap, the queue is full.
+                return false;
+            } else {
+                pos = m_write_index.load(std::memory_order::relaxed);
+            }
+        }
+        cell->data = T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order::release);
+        return true;
+    }
+
+    bool TryPop(T& t) {
+        std::size_t pos = m_read_index.load(std::memory_order::relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &m_cells[pos % Capacity];
+            const std::size_t sequence = cell->sequence.load(std::memory_order::acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+            if (diff == 0) {
+                if (m_read_index.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order::relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The queue is empty or the producer of this slot has not published it yet.
+                return false;
+            } else {
+                pos = m_read_index.load(std::memory_order::relaxed);
+            }
+        }
+        t = std::move(cell->data);
+        cell->sequence.store(pos + Capacity, std::memory_order::release);
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic_size_t sequence;
+        T data;
+    };
+
+    alignas(128) std::atomic_size_t m_read_index{0};
+    alignas(128) std::atomic_size_t m_write_index{0};
+
+    alignas(128) std::array<Cell, Capacity> m_cells;
+};
+
 } // namespace Common
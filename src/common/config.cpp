@@ -146,6 +146,9 @@ static ConfigEntry<string> userName("shadPS4");
 static ConfigEntry<bool> isShowSplash(false);
 static ConfigEntry<string> isSideTrophy("right");
 static ConfigEntry<bool> isConnectedToNetwork(false);
+static ConfigEntry<bool> parallelModuleLoading(false);
+static ConfigEntry<u32> zlibWorkerThreads(0);
+static ConfigEntry<bool> mapGameFiles(false);
 static bool enableDiscordRPC = false;
 static std::filesystem::path sys_modules_path = {};
 static std::filesystem::path fonts_path = {};
@@ -198,6 +201,8 @@ static ConfigEntry<bool> vkGuestMarkers(false);
 static ConfigEntry<bool> rdocEnable(false);
 static ConfigEntry<bool> pipelineCacheEnable(false);
 static ConfigEntry<bool> pipelineCacheArchive(false);
+static ConfigEntry<bool> asyncPipelineCompile(false);
+static ConfigEntry<u32> asyncPipelineSkipFrames(4);
 
 // Debug
 static ConfigEntry<bool> isDebugDump(false);
@@ -432,6 +437,18 @@ string sideTrophy() {
     return isSideTrophy.get();
 }
 
+bool isParallelModuleLoadingEnabled() {
+    return parallelModuleLoading.get();
+}
+
+u32 getZlibWorkerThreads() {
+    return zlibWorkerThreads.get();
+}
+
+bool isMapGameFilesEnabled() {
+    return mapGameFiles.get();
+}
+
 bool nullGpu() {
     return isNullGpu.get();
 }
@@ -472,6 +489,14 @@ bool isPipelineCacheArchived() {
     return pipelineCacheArchive.get();
 }
 
+bool isAsyncPipelineCompileEnabled() {
+    return asyncPipelineCompile.get();
+}
+
+u32 getAsyncPipelineSkipFrames() {
+    return asyncPipelineSkipFrames.get();
+}
+
 bool getShowFpsCounter() {
     return showFpsCounter.get();
 }
@@ -579,6 +604,18 @@ void setSideTrophy(string side, bool is_game_specific) {
     isSideTrophy.set(side, is_game_specific);
 }
 
+void setParallelModuleLoadingEnabled(bool enable, bool is_game_specific) {
+    parallelModuleLoading.set(enable, is_game_specific);
+}
+
+void setZlibWorkerThreads(u32 count, bool is_game_specific) {
+    zlibWorkerThreads.set(count, is_game_specific);
+}
+
+void setMapGameFilesEnabled(bool enable, bool is_game_specific) {
+    mapGameFiles.set(enable, is_game_specific);
+}
+
 void setNullGpu(bool enable, bool is_game_specific) {
     isNullGpu.set(enable, is_game_specific);
 }
@@ -635,6 +672,14 @@ void setPipelineCacheArchived(bool enable, bool is_game_specific) {
     pipelineCacheArchive.set(enable, is_game_specific);
 }
 
+void setAsyncPipelineCompileEnabled(bool enable, bool is_game_specific) {
+    asyncPipelineCompile.set(enable, is_game_specific);
+}
+
+void setAsyncPipelineSkipFrames(u32 frames, bool is_game_specific) {
+    asyncPipelineSkipFrames.set(frames, is_game_specific);
+}
+
 void setVblankFreq(u32 value, bool is_game_specific) {
     vblankFrequency.set(value, is_game_specific);
 }
@@ -906,6 +951,9 @@ void load(const std::filesystem::path& path, bool is_game_specific) {
         userName.setFromToml(general, "userName", is_game_specific);
         isShowSplash.setFromToml(general, "showSplash", is_game_specific);
         isSideTrophy.setFromToml(general, "sideTrophy", is_game_specific);
+        parallelModuleLoading.setFromToml(general, "parallelModuleLoading", is_game_specific);
+        zlibWorkerThreads.setFromToml(general, "zlibWorkerThreads", is_game_specific);
+        mapGameFiles.setFromToml(general, "mapGameFiles", is_game_specific);
 
         isConnectedToNetwork.setFromToml(general, "isConnectedToNetwork", is_game_specific);
         defaultControllerID.setFromToml(general, "defaultControllerID", is_game_specific);
@@ -972,6 +1020,8 @@ void load(const std::filesystem::path& path, bool is_game_specific) {
         rdocEnable.setFromToml(vk, "rdocEnable", is_game_specific);
         pipelineCacheEnable.setFromToml(vk, "pipelineCacheEnable", is_game_specific);
         pipelineCacheArchive.setFromToml(vk, "pipelineCacheArchive", is_game_specific);
+        asyncPipelineCompile.setFromToml(vk, "asyncPipelineCompile", is_game_specific);
+        asyncPipelineSkipFrames.setFromToml(vk, "asyncPipelineSkipFrames", is_game_specific);
     }
 
     string current_version = {};
@@ -1095,6 +1145,10 @@ void save(const std::filesystem::path& path, bool is_game_specific) {
     userName.setTomlValue(data, "General", "userName", is_game_specific);
     isShowSplash.setTomlValue(data, "General", "showSplash", is_game_specific);
     isSideTrophy.setTomlValue(data, "General", "sideTrophy", is_game_specific);
+    parallelModuleLoading.setTomlValue(data, "General", "parallelModuleLoading",
+                                       is_game_specific);
+    zlibWorkerThreads.setTomlValue(data, "General", "zlibWorkerThreads", is_game_specific);
+    mapGameFiles.setTomlValue(data, "General", "mapGameFiles", is_game_specific);
     isNeo.setTomlValue(data, "General", "isPS4Pro", is_game_specific);
     isDevKit.setTomlValue(data, "General", "isDevKit", is_game_specific);
     if (is_game_specific) {
@@ -1143,6 +1197,9 @@ void save(const std::filesystem::path& path, bool is_game_specific) {
     rdocEnable.setTomlValue(data, "Vulkan", "rdocEnable", is_game_specific);
     pipelineCacheEnable.setTomlValue(data, "Vulkan", "pipelineCacheEnable", is_game_specific);
     pipelineCacheArchive.setTomlValue(data, "Vulkan", "pipelineCacheArchive", is_game_specific);
+    asyncPipelineCompile.setTomlValue(data, "Vulkan", "asyncPipelineCompile", is_game_specific);
+    asyncPipelineSkipFrames.setTomlValue(data, "Vulkan", "asyncPipelineSkipFrames",
+                                         is_game_specific);
 
     isDebugDump.setTomlValue(data, "Debug", "DebugDump", is_game_specific);
     isShaderDebug.setTomlValue(data, "Debug", "CollectShader", is_game_specific);
@@ -1239,6 +1296,9 @@ void setDefaultValues(bool is_game_specific) {
     userName.set("shadPS4", is_game_specific);
     isShowSplash.set(false, is_game_specific);
     isSideTrophy.set("right", is_game_specific);
+    parallelModuleLoading.set(false, is_game_specific);
+    zlibWorkerThreads.set(0, is_game_specific);
+    mapGameFiles.set(false, is_game_specific);
 
     // GS - Input
     cursorState.set(HideCursorState::Idle, is_game_specific);
@@ -1277,6 +1337,8 @@ void setDefaultValues(bool is_game_specific) {
     rdocEnable.set(false, is_game_specific);
     pipelineCacheEnable.set(false, is_game_specific);
     pipelineCacheArchive.set(false, is_game_specific);
+    asyncPipelineCompile.set(false, is_game_specific);
+    asyncPipelineSkipFrames.set(4, is_game_specific);
 
     // GS - Debug
     isDebugDump.set(false, is_game_specific);
@@ -59,6 +59,12 @@ bool showSplash();
 void setShowSplash(bool enable, bool is_game_specific = false);
 std::string sideTrophy();
 void setSideTrophy(std::string side, bool is_game_specific = false);
+bool isParallelModuleLoadingEnabled();
+void setParallelModuleLoadingEnabled(bool enable, bool is_game_specific = false);
+u32 getZlibWorkerThreads();
+void setZlibWorkerThreads(u32 count, bool is_game_specific = false);
+bool isMapGameFilesEnabled();
+void setMapGameFilesEnabled(bool enable, bool is_game_specific = false);
 bool nullGpu();
 void setNullGpu(bool enable, bool is_game_specific = false);
 bool copyGPUCmdBuffers();
@@ -96,9 +102,13 @@ void setEnableDiscordRPC(bool enable);
 bool isRdocEnabled();
 bool isPipelineCacheEnabled();
 bool isPipelineCacheArchived();
+bool isAsyncPipelineCompileEnabled();
+u32 getAsyncPipelineSkipFrames();
 void setRdocEnabled(bool enable, bool is_game_specific = false);
 void setPipelineCacheEnabled(bool enable, bool is_game_specific = false);
 void setPipelineCacheArchived(bool enable, bool is_game_specific = false);
+void setAsyncPipelineCompileEnabled(bool enable, bool is_game_specific = false);
+void setAsyncPipelineSkipFrames(u32 frames, bool is_game_specific = false);
 std::string getLogType();
 void setLogType(const std::string& type, bool is_game_specific = false);
 bool groupIdenticalLogs();
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2021 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <cerrno>
 #include <vector>
 
 #include "common/alignment.h"
@@ -17,6 +19,9 @@
 #include <share.h>
 #include <windows.h>
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #endif
 
@@ -164,6 +169,9 @@ IOFile::IOFile(IOFile&& other) noexcept {
     std::swap(file_access_mode, other.file_access_mode);
     std::swap(file_type, other.file_type);
     std::swap(file, other.file);
+#ifdef _WIN32
+    std::swap(positional_handle, other.positional_handle);
+#endif
 }
 
 IOFile& IOFile::operator=(IOFile&& other) noexcept {
@@ -171,6 +179,9 @@ IOFile& IOFile::operator=(IOFile&& other) noexcept {
     std::swap(file_access_mode, other.file_access_mode);
     std::swap(file_type, other.file_type);
     std::swap(file, other.file);
+#ifdef _WIN32
+    std::swap(positional_handle, other.positional_handle);
+#endif
     return *this;
 }
 
@@ -202,6 +213,22 @@ int IOFile::Open(const fs::path& path, FileAccessMode mode, FileType type, FileS
                   PathToUTF8String(file_path), ec.message());
     }
 
+#ifdef _WIN32
+    if (IsOpen() && True(mode & FileAccessMode::Read)) {
+        // Positional reads on the stream's own handle would move its file pointer.
+        const HANDLE hfile = reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+        constexpr DWORD share_mode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+        const HANDLE reopened = ReOpenFile(hfile, GENERIC_READ, share_mode, FILE_FLAG_OVERLAPPED);
+        if (reopened != INVALID_HANDLE_VALUE) {
+            positional_handle = reopened;
+        } else {
+            LOG_WARNING(Common_Filesystem,
+                        "Failed to reopen the file at path={} for positional reads, error={}",
+                        PathToUTF8String(file_path), Common::GetLastErrorMsg());
+        }
+    }
+#endif
+
     return result;
 }
 
@@ -222,6 +249,13 @@ void IOFile::Close() {
 
     file = nullptr;
 
+#ifdef _WIN32
+    if (positional_handle) {
+        CloseHandle(positional_handle);
+        positional_handle = nullptr;
+    }
+#endif
+
 #ifdef _WIN64
     if (file_mapping && file_access_mode == FileAccessMode::ReadWrite) {
         CloseHandle(std::bit_cast<HANDLE>(file_mapping));
@@ -406,6 +440,303 @@ s64 IOFile::Tell() const {
     return ftello(file);
 }
 
+#ifdef _WIN32
+namespace {
+
+// Transfers at offset with an OVERLAPPED structure, in chunks that fit the DWORD sizes. On a
+// handle opened without FILE_FLAG_OVERLAPPED this also moves the handle's file pointer.
+template <typename Transfer>
+s64 TransferAt(HANDLE handle, size_t size, s64 offset, Transfer&& transfer) {
+    // Overlapped handles can run several transfers at once, each needs its own event to wait on.
+    thread_local const HANDLE event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+
+    size_t done = 0;
+    while (done < size) {
+        const u64 position = static_cast<u64>(offset) + done;
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        overlapped.hEvent = event;
+        const DWORD chunk = static_cast<DWORD>(std::min<size_t>(size - done, 1_GB));
+        DWORD transferred = 0;
+        if (!transfer(done, chunk, &overlapped) && GetLastError() != ERROR_IO_PENDING) {
+            if (GetLastError() == ERROR_HANDLE_EOF) {
+                break;
+            }
+            errno = EIO;
+            return -1;
+        }
+        if (!GetOverlappedResult(handle, &overlapped, &transferred, TRUE)) {
+            if (GetLastError() == ERROR_HANDLE_EOF) {
+                break;
+            }
+            errno = EIO;
+            return -1;
+        }
+        done += transferred;
+        if (transferred < chunk) {
+            break;
+        }
+    }
+    return static_cast<s64>(done);
+}
+
+} // Anonymous namespace
+#endif
+
+s64 IOFile::ReadAt(void* data, size_t size, s64 offset) const {
+    if (!IsOpen()) {
+        errno = EBADF;
+        return -1;
+    }
+
+#ifdef _WIN32
+    const bool own_handle = positional_handle != nullptr;
+    const HANDLE handle = own_handle ? positional_handle
+                                     : reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+    // Without a handle of its own the read has to put the stream's file pointer back.
+    const s64 position = own_handle ? 0 : ftello(file);
+    const s64 result = TransferAt(handle, size, offset, [&](size_t done, DWORD chunk, auto* ov) {
+        return ReadFile(handle, static_cast<u8*>(data) + done, chunk, nullptr, ov);
+    });
+    if (!own_handle) {
+        fseeko(file, position, SEEK_SET);
+    }
+    return result;
+#else
+    size_t done = 0;
+    while (done < size) {
+        const ssize_t ret = pread(fileno(file), static_cast<u8*>(data) + done, size - done,
+                                  static_cast<off_t>(offset + done));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (ret == 0) {
+            break;
+        }
+        done += static_cast<size_t>(ret);
+    }
+    return static_cast<s64>(done);
+#endif
+}
+
+u64 IOFile::GetSizeAt() const {
+    if (!IsOpen()) {
+        return 0;
+    }
+
+#ifdef _WIN32
+    const HANDLE handle = positional_handle != nullptr
+                              ? positional_handle
+                              : reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(handle, &size)) {
+        LOG_ERROR(Common_Filesystem, "Failed to retrieve the file size of path={}, error={}",
+                  PathToUTF8String(file_path), GetLastError());
+        return 0;
+    }
+    return static_cast<u64>(size.QuadPart);
+#else
+    struct stat st{};
+    if (fstat(fileno(file), &st) != 0) {
+        const auto ec = std::error_code{errno, std::generic_category()};
+        LOG_ERROR(Common_Filesystem, "Failed to retrieve the file size of path={}, ec_message={}",
+                  PathToUTF8String(file_path), ec.message());
+        return 0;
+    }
+    return static_cast<u64>(st.st_size);
+#endif
+}
+
+s64 IOFile::WriteAt(const void* data, size_t size, s64 offset) const {
+    if (!IsOpen()) {
+        errno = EBADF;
+        return -1;
+    }
+
+    // Earlier buffered writes have to land first, and buffered reads may be stale afterwards.
+    std::fflush(file);
+    const s64 position = ftello(file);
+
+#ifdef _WIN32
+    const HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(fileno(file)));
+    const s64 result = TransferAt(handle, size, offset, [&](size_t done, DWORD chunk, auto* ov) {
+        return WriteFile(handle, static_cast<const u8*>(data) + done, chunk, nullptr, ov);
+    });
+#else
+    s64 result = 0;
+    while (static_cast<size_t>(result) < size) {
+        const ssize_t ret = pwrite(fileno(file), static_cast<const u8*>(data) + result,
+                                   size - result, static_cast<off_t>(offset + result));
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = -1;
+            break;
+        }
+        result += ret;
+    }
+#endif
+
+    const int error = errno;
+    fseeko(file, position, SEEK_SET);
+    errno = error;
+    return result;
+}
+
+#ifndef _WIN32
+namespace {
+
+/// Maps files of at least a huge page at a huge page boundary, so the kernel is free to back the
+/// page cache with huge pages where the filesystem supports it. Returns MAP_FAILED otherwise.
+void* MapHugePageAligned(int fd, size_t file_size) {
+    constexpr size_t HugePageSize = 2_MB;
+    if (file_size < HugePageSize) {
+        return MAP_FAILED;
+    }
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t reserve_size = file_size + HugePageSize;
+    void* reserved = mmap(nullptr, reserve_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        return MAP_FAILED;
+    }
+    const uintptr_t reserve_start = reinterpret_cast<uintptr_t>(reserved);
+    const uintptr_t reserve_end = reserve_start + reserve_size;
+    const uintptr_t start = Common::AlignUp(reserve_start, HugePageSize);
+    const uintptr_t end = start + Common::AlignUp(file_size, page_size);
+
+    void* view = mmap(reinterpret_cast<void*>(start), file_size, PROT_READ, MAP_SHARED | MAP_FIXED,
+                      fd, 0);
+    if (view == MAP_FAILED) {
+        munmap(reserved, reserve_size);
+        return MAP_FAILED;
+    }
+    // Give back the parts of the reservation around the view.
+    if (start > reserve_start) {
+        munmap(reserved, start - reserve_start);
+    }
+    if (reserve_end > end) {
+        munmap(reinterpret_cast<void*>(end), reserve_end - end);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(view, file_size, MADV_HUGEPAGE);
+#endif
+    return view;
+}
+
+} // Anonymous namespace
+#endif
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const fs::path& path) {
+    Open(path);
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    return *this;
+}
+
+bool MappedFile::Open(const fs::path& path) {
+    Close();
+
+    std::error_code ec;
+    const auto file_size = fs::file_size(path, ec);
+    if (ec || file_size == 0) {
+        return false;
+    }
+
+#ifdef _WIN32
+    constexpr DWORD share_mode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+    const HANDLE hfile = CreateFileW(path.c_str(), GENERIC_READ, share_mode, nullptr,
+                                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hfile == INVALID_HANDLE_VALUE) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={} for mapping, error={}",
+                  PathToUTF8String(path), Common::GetLastErrorMsg());
+        return false;
+    }
+    const HANDLE mapping = CreateFileMappingW(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(hfile);
+    if (!mapping) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, error={}",
+                  PathToUTF8String(path), Common::GetLastErrorMsg());
+        return false;
+    }
+    // The view keeps the section alive on its own.
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, file_size);
+    CloseHandle(mapping);
+    if (!view) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, error={}",
+                  PathToUTF8String(path), Common::GetLastErrorMsg());
+        return false;
+    }
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={} for mapping, error={}",
+                  PathToUTF8String(path), Common::GetLastErrorMsg());
+        return false;
+    }
+    void* view = MapHugePageAligned(fd, file_size);
+    if (view == MAP_FAILED) {
+        view = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, error={}",
+                  PathToUTF8String(path), Common::GetLastErrorMsg());
+        return false;
+    }
+#endif
+
+    data = static_cast<const u8*>(view);
+    size = file_size;
+    return true;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t length) const {
+    if (!IsOpen() || offset >= size) {
+        return;
+    }
+    length = std::min(length, size - offset);
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range{const_cast<u8*>(data) + offset, length};
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+    const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t start = Common::AlignDown(offset, page_size);
+    madvise(const_cast<u8*>(data) + start, offset + length - start, MADV_WILLNEED);
+#endif
+}
+
+void MappedFile::Close() {
+    if (!IsOpen()) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<u8*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
 u64 GetDirectorySize(const std::filesystem::path& path) {
     if (!fs::exists(path)) {
         return 0;
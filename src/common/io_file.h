@@ -130,6 +130,27 @@ public:
     bool Seek(s64 offset, SeekOrigin origin = SeekOrigin::SetOrigin) const;
     s64 Tell() const;
 
+    /**
+     * Reads up to size bytes at offset straight from the file descriptor, without using or moving
+     * the file position. Any number of threads may read this way at once, also while another one
+     * does sequential I/O. Returns the number of bytes read, or -1 with errno set on failure.
+     */
+    s64 ReadAt(void* data, size_t size, s64 offset) const;
+
+    /**
+     * Returns the size of the file as ReadAt sees it, from the file descriptor. Unlike GetSize
+     * this does not flush the stream or take its lock, so it does not serialize positional
+     * readers. Data still buffered by sequential writes is not counted.
+     */
+    u64 GetSizeAt() const;
+
+    /**
+     * Writes size bytes at offset without moving the file position. Buffered data is flushed
+     * first and read buffers are dropped afterwards, so this must not race sequential I/O on the
+     * same file. Returns the number of bytes written, or -1 with errno set on failure.
+     */
+    s64 WriteAt(const void* data, size_t size, s64 offset) const;
+
     template <typename T>
     size_t Read(T& data) const {
         if constexpr (IsContiguousContainer<T>) {
@@ -231,6 +252,48 @@ private:
     FileType file_type{};
 
     uintptr_t file_mapping = 0;
+#ifdef _WIN32
+    // Overlapped handle for ReadAt, which does not share the file pointer of the stdio stream.
+    void* positional_handle = nullptr;
+#endif
+};
+
+/// Read-only memory mapping of a whole file. The view stays valid while the file is appended to
+/// by other handles, but only covers the size the file had when it was mapped. Files of 2MB or
+/// more are mapped at a 2MB boundary, so they can be backed by huge pages.
+class MappedFile {
+public:
+    MappedFile();
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    bool IsOpen() const {
+        return data != nullptr;
+    }
+
+    std::span<const u8> Data() const {
+        return {data, size};
+    }
+
+    size_t Size() const {
+        return size;
+    }
+
+    /// Hints that a range will be read soon, so the OS can start reading it in.
+    void Prefetch(size_t offset, size_t length) const;
+
+private:
+    const u8* data = nullptr;
+    size_t size = 0;
 };
 
 u64 GetDirectorySize(const std::filesystem::path& path);
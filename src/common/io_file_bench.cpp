@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <fmt/format.h>
+
+#include "common/io_file.h"
+#include "common/io_file_bench.h"
+
+namespace Common::FS {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr u64 FileSize = 128_MB;
+constexpr u64 SequentialChunk = 1_MB;
+constexpr u64 MinReadSize = 4_KB;
+constexpr u64 MaxReadSize = 256_KB;
+constexpr u32 ReadsPerThread = 2048;
+
+enum class ReadMode {
+    LockedSeek, ///< What posix_preadv did before ReadAt: seek and read under the file mutex.
+    ReadAt,     ///< IOFile::ReadAt, used for files opened outside of the game image.
+    Mapped,     ///< Copies from a MappedFile, used for game files.
+};
+
+struct ModeResult {
+    double random_s;
+    double sequential_s;
+    u64 random_bytes;
+    u64 num_errors;
+};
+
+ModeResult RunMode(ReadMode mode, const std::filesystem::path& path, std::span<const u8> reference,
+                   u32 num_jobs) {
+    IOFile file{path, FileAccessMode::Read};
+    MappedFile mapping{};
+    if (mode == ReadMode::Mapped) {
+        mapping.Open(path);
+    }
+    std::mutex file_mutex;
+    std::atomic<u64> num_errors{};
+    std::atomic<u64> random_bytes{};
+
+    const auto random_reader = [&](u32 seed) {
+        std::mt19937_64 rng{seed};
+        std::uniform_int_distribution<u64> size_dist{MinReadSize, MaxReadSize};
+        std::vector<u8> buffer(MaxReadSize);
+        u64 bytes = 0;
+        for (u32 i = 0; i < ReadsPerThread; i++) {
+            const u64 size = size_dist(rng);
+            const u64 offset = std::uniform_int_distribution<u64>{0, FileSize - size}(rng);
+            s64 read = 0;
+            switch (mode) {
+            case ReadMode::LockedSeek: {
+                std::scoped_lock lk{file_mutex};
+                const s64 position = file.Tell();
+                file.Seek(offset);
+                read = file.ReadRaw<u8>(buffer.data(), size);
+                file.Seek(position);
+                break;
+            }
+            case ReadMode::ReadAt:
+                read = file.ReadAt(buffer.data(), size, offset);
+                break;
+            case ReadMode::Mapped:
+                std::memcpy(buffer.data(), mapping.Data().data() + offset, size);
+                read = size;
+                break;
+            }
+            if (read != static_cast<s64>(size) ||
+                std::memcmp(buffer.data(), reference.data() + offset, size) != 0) {
+                ++num_errors;
+            }
+            bytes += size;
+        }
+        random_bytes += bytes;
+    };
+
+    // The sequential reader shares the stream with the random readers, it catches positional
+    // reads that move the stream position.
+    double sequential_s = 0.0;
+    const auto sequential_reader = [&] {
+        std::vector<u8> buffer(SequentialChunk);
+        const auto start = Clock::now();
+        for (u64 offset = 0; offset < FileSize; offset += SequentialChunk) {
+            size_t read = 0;
+            if (mode == ReadMode::LockedSeek) {
+                std::scoped_lock lk{file_mutex};
+                read = file.ReadRaw<u8>(buffer.data(), SequentialChunk);
+            } else {
+                read = file.ReadRaw<u8>(buffer.data(), SequentialChunk);
+            }
+            if (read != SequentialChunk ||
+                std::memcmp(buffer.data(), reference.data() + offset, SequentialChunk) != 0) {
+                ++num_errors;
+            }
+        }
+        sequential_s = std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    const auto start = Clock::now();
+    {
+        std::vector<std::jthread> threads;
+        threads.emplace_back(sequential_reader);
+        for (u32 i = 0; i < num_jobs; i++) {
+            threads.emplace_back(random_reader, i + 1);
+        }
+    }
+    return ModeResult{
+        .random_s = std::chrono::duration<double>(Clock::now() - start).count(),
+        .sequential_s = sequential_s,
+        .random_bytes = random_bytes,
+        .num_errors = num_errors,
+    };
+}
+
+} // Anonymous namespace
+
+int BenchmarkFileReads(const std::filesystem::path& dir, u32 num_jobs) {
+    if (num_jobs == 0) {
+        num_jobs = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    std::vector<u8> reference(FileSize);
+    std::mt19937_64 rng{0x5eed};
+    for (u64 i = 0; i < FileSize; i += sizeof(u64)) {
+        const u64 value = rng();
+        std::memcpy(&reference[i], &value, sizeof(value));
+    }
+
+    const auto path = dir / "shadps4_read_bench.bin";
+    {
+        IOFile out{path, FileAccessMode::Create};
+        if (!out.IsOpen() || out.WriteSpan(std::span<const u8>{reference}) != FileSize) {
+            fmt::print("Unable to write the scratch file {}\n", path.string());
+            return 1;
+        }
+    }
+
+    static constexpr std::array<std::pair<ReadMode, std::string_view>, 3> Modes = {{
+        {ReadMode::LockedSeek, "Locked seek+read"},
+        {ReadMode::ReadAt, "IOFile::ReadAt"},
+        {ReadMode::Mapped, "MappedFile copy"},
+    }};
+
+    fmt::print("{} random readers, {} reads each of {}-{} KB, on a {} MB file\n", num_jobs,
+               ReadsPerThread, MinReadSize / 1_KB, MaxReadSize / 1_KB, FileSize / 1_MB);
+    fmt::print("\n{:<20} {:>14} {:>14} {:>16} {:>8}\n", "Mode", "Random (MB/s)", "Reads/s",
+               "Sequential (ms)", "Errors");
+
+    u64 total_errors = 0;
+    for (const auto& [mode, name] : Modes) {
+        const auto result = RunMode(mode, path, reference, num_jobs);
+        const u64 num_reads = u64(ReadsPerThread) * num_jobs;
+        const double random_mb = double(result.random_bytes) / 1_MB;
+        fmt::print("{:<20} {:>14.1f} {:>14.0f} {:>16.1f} {:>8}\n", name,
+                   random_mb / result.random_s, num_reads / result.random_s,
+                   result.sequential_s * 1e3, result.num_errors);
+        total_errors += result.num_errors;
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return total_errors == 0 ? 0 : 1;
+}
+
+} // namespace Common::FS
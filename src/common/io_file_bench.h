@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+
+#include "common/types.h"
+
+namespace Common::FS {
+
+/**
+ * Reads one large scratch file from many threads at random offsets while another thread reads it
+ * sequentially through the stream, once for each way posix_preadv can serve a game file, and
+ * checks every byte read. The scratch file is deleted afterwards.
+ * @param dir        Directory to create the scratch file in.
+ * @param num_jobs   Number of random reader threads, 0 to use all hardware threads.
+ * @returns Process exit code, non-zero if any read returned wrong data.
+ */
+int BenchmarkFileReads(const std::filesystem::path& dir, u32 num_jobs);
+
+} // namespace Common::FS
@@ -2,10 +2,15 @@
 // SPDX-FileCopyrightText: Copyright 2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -13,6 +18,7 @@
 #include <windows.h> // For OutputDebugStringW
 #endif
 
+#include "common/alignment.h"
 #include "common/bounded_threadsafe_queue.h"
 #include "common/config.h"
 #include "common/debug.h"
@@ -121,6 +127,79 @@ public:
 
 bool initialization_in_progress_suppress_logging = true;
 
+/**
+ * Single producer, single consumer byte ring holding the deferred messages of one thread. Each
+ * record is a header followed by the packed arguments, records that would wrap around are placed
+ * at the start of the buffer after a padding record.
+ */
+struct DeferredRing {
+    static constexpr size_t Capacity = 1_MB;
+    static constexpr size_t MaxRecordSize = 64_KB;
+    static constexpr u32 PaddingMarker = ~0U;
+
+    struct Header {
+        u32 size;
+        u32 args_size;
+        std::chrono::microseconds timestamp;
+        DeferredMessage message;
+    };
+    /// Size of the part of the header a padding record has.
+    static constexpr size_t PrefixSize = 2 * sizeof(u32);
+
+    explicit DeferredRing(std::string thread_name_) : thread_name{std::move(thread_name_)} {}
+
+    /// Returns the header of the oldest record, skipping padding, or nullopt if the ring is empty.
+    std::optional<Header> Front() {
+        size_t read_pos = tail.load(std::memory_order_relaxed);
+        const size_t write_pos = head.load(std::memory_order_acquire);
+        while (read_pos != write_pos) {
+            Header header;
+            std::memcpy(&header, buffer.get() + read_pos % Capacity, PrefixSize);
+            if (header.args_size != PaddingMarker) {
+                std::memcpy(&header, buffer.get() + read_pos % Capacity, sizeof(Header));
+                return header;
+            }
+            read_pos += header.size;
+            tail.store(read_pos, std::memory_order_release);
+        }
+        return std::nullopt;
+    }
+
+    const u8* FrontArgs() const {
+        return buffer.get() + tail.load(std::memory_order_relaxed) % Capacity + sizeof(Header);
+    }
+
+    void Pop(const Header& header) {
+        tail.store(tail.load(std::memory_order_relaxed) + header.size, std::memory_order_release);
+    }
+
+    bool Empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_relaxed);
+    }
+
+    std::unique_ptr<u8[]> buffer{std::make_unique<u8[]>(Capacity)};
+    alignas(64) std::atomic<size_t> head{};
+    alignas(64) std::atomic<size_t> tail{};
+    size_t pending_head{};
+    std::string thread_name;
+    std::atomic_bool orphaned{};
+};
+
+/// The ring of the current thread, handed to the backend of the logger instance that created it.
+struct ThreadRing {
+    ~ThreadRing() {
+        if (ring) {
+            ring->orphaned.store(true, std::memory_order_release);
+        }
+    }
+
+    std::shared_ptr<DeferredRing> ring;
+    u64 instance_id{};
+};
+
+thread_local ThreadRing thread_ring;
+std::atomic<u64> next_instance_id{};
+
 /**
  * Static state as a singleton.
  */
@@ -183,6 +262,16 @@ public:
         color_console_backend.SetEnabled(enabled);
     }
 
+    LogPath GetLogPath(Class log_class, Level log_level) const {
+        if (!filter.CheckMessage(log_class, log_level) || !Config::getLoggingEnabled()) {
+            return LogPath::Disabled;
+        }
+        if (deferred && deferred_running.load(std::memory_order_relaxed)) {
+            return LogPath::Deferred;
+        }
+        return LogPath::Immediate;
+    }
+
     void PushEntry(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, const char* format, const fmt::format_args& args) {
         if (!filter.CheckMessage(log_class, log_level) || !Config::getLoggingEnabled()) {
@@ -191,24 +280,15 @@ public:
 
         const auto message = fmt::vformat(format, args);
 
-        // Propagate important log messages to the profiler
-        if (IsProfilerConnected()) {
-            const auto& msg_str = fmt::format("[{}] {}", GetLogClassName(log_class), message);
-            switch (log_level) {
-            case Level::Warning:
-                TRACE_WARN(msg_str);
-                break;
-            case Level::Error:
-                TRACE_ERROR(msg_str);
-                break;
-            case Level::Critical:
-                TRACE_CRIT(msg_str);
-                break;
-            default:
-                break;
-            }
+        // Arguments that cannot be captured are formatted here, but the message still goes through
+        // the ring so it keeps its place among the deferred ones.
+        if (deferred &&
+            PushFormatted(log_class, log_level, filename, line_num, function, message)) {
+            return;
         }
 
+        TraceMessage(log_class, log_level, message);
+
         using std::chrono::duration_cast;
         using std::chrono::microseconds;
         using std::chrono::steady_clock;
@@ -267,13 +347,225 @@ public:
         }
     }
 
+    u8* BeginDeferred(const DeferredMessage& message, size_t args_size) {
+        using Header = DeferredRing::Header;
+        const size_t size = Common::AlignUp(sizeof(Header) + args_size, alignof(Header));
+        if (size > DeferredRing::MaxRecordSize ||
+            !deferred_running.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        DeferredRing& ring = CurrentRing();
+        size_t write_pos = ring.head.load(std::memory_order_relaxed);
+        const size_t to_end = DeferredRing::Capacity - write_pos % DeferredRing::Capacity;
+        const size_t padding = to_end < size ? to_end : 0;
+        while (DeferredRing::Capacity - (write_pos - ring.tail.load(std::memory_order_acquire)) <
+               padding + size) {
+            // Past shutdown nothing frees up space, log the message immediately instead.
+            if (!deferred_running.load(std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            std::this_thread::yield();
+        }
+        if (padding != 0) {
+            Header pad{};
+            pad.size = static_cast<u32>(padding);
+            pad.args_size = DeferredRing::PaddingMarker;
+            std::memcpy(ring.buffer.get() + write_pos % DeferredRing::Capacity, &pad,
+                        DeferredRing::PrefixSize);
+            write_pos += padding;
+        }
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        using std::chrono::steady_clock;
+        const Header header{
+            .size = static_cast<u32>(size),
+            .args_size = static_cast<u32>(args_size),
+            .timestamp = duration_cast<microseconds>(steady_clock::now() - time_origin),
+            .message = message,
+        };
+        u8* const record = ring.buffer.get() + write_pos % DeferredRing::Capacity;
+        std::memcpy(record, &header, sizeof(Header));
+        ring.pending_head = write_pos + size;
+        return record + sizeof(Header);
+    }
+
+    void EndDeferred() {
+        DeferredRing& ring = *thread_ring.ring;
+        ring.head.store(ring.pending_head, std::memory_order_release);
+        // Pairs with the fence in the backend loop, so either the backend sees the new record or
+        // this thread sees it going to sleep.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (backend_sleeping.load(std::memory_order_relaxed)) {
+            backend_sleeping.store(false, std::memory_order_relaxed);
+            backend_sleeping.notify_one();
+        }
+    }
+
 private:
     Impl(const std::filesystem::path& file_backend_filename, const Filter& filter_)
-        : filter{filter_}, file_backend{file_backend_filename, should_append} {}
+        : filter{filter_}, file_backend{file_backend_filename, should_append},
+          deferred{Config::getLogType() == "deferred"} {}
 
     ~Impl() = default;
 
+    static void TraceMessage(Class log_class, Level log_level, const std::string& message) {
+        // Propagate important log messages to the profiler
+        if (IsProfilerConnected()) {
+            const auto& msg_str = fmt::format("[{}] {}", GetLogClassName(log_class), message);
+            switch (log_level) {
+            case Level::Warning:
+                TRACE_WARN(msg_str);
+                break;
+            case Level::Error:
+                TRACE_ERROR(msg_str);
+                break;
+            case Level::Critical:
+                TRACE_CRIT(msg_str);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    DeferredRing& CurrentRing() {
+        if (thread_ring.instance_id != instance_id) {
+            if (thread_ring.ring) {
+                thread_ring.ring->orphaned.store(true, std::memory_order_release);
+            }
+            thread_ring.ring = std::make_shared<DeferredRing>(Common::GetCurrentThreadName());
+            thread_ring.instance_id = instance_id;
+            std::scoped_lock lock{rings_mutex};
+            rings.push_back(thread_ring.ring);
+        }
+        return *thread_ring.ring;
+    }
+
+    bool PushFormatted(Class log_class, Level log_level, const char* filename,
+                       unsigned int line_num, const char* function, std::string_view message) {
+        constexpr size_t MaxMessageSize =
+            DeferredRing::MaxRecordSize - sizeof(DeferredRing::Header) - sizeof(u32);
+        return Deferred::Push(log_class, log_level, filename, line_num, function, "{}",
+                              message.substr(0, MaxMessageSize));
+    }
+
+    /// Writes out up to max_messages deferred messages, oldest first across all threads.
+    size_t DrainDeferred(size_t max_messages) {
+        {
+            std::scoped_lock lock{rings_mutex};
+            std::erase_if(rings, [](const auto& ring) {
+                return ring->orphaned.load(std::memory_order_acquire) && ring->Empty();
+            });
+            drain_rings = rings;
+        }
+        size_t num_written = 0;
+        while (num_written < max_messages) {
+            DeferredRing* oldest_ring = nullptr;
+            DeferredRing::Header oldest;
+            for (const auto& ring : drain_rings) {
+                const auto header = ring->Front();
+                if (header && (!oldest_ring || header->timestamp < oldest.timestamp)) {
+                    oldest_ring = ring.get();
+                    oldest = *header;
+                }
+            }
+            if (!oldest_ring) {
+                break;
+            }
+            WriteDeferred(*oldest_ring, oldest);
+            oldest_ring->Pop(oldest);
+            ++num_written;
+        }
+        drain_rings.clear();
+        return num_written;
+    }
+
+    bool HasDeferredMessages() {
+        std::scoped_lock lock{rings_mutex};
+        return std::ranges::any_of(rings, [](const auto& ring) { return !ring->Empty(); });
+    }
+
+    void WriteDeferred(const DeferredRing& ring, const DeferredRing::Header& header) {
+        const DeferredMessage& message = header.message;
+        std::string text;
+        try {
+            text = message.format_fn(message.format, ring.FrontArgs());
+        } catch (const fmt::format_error& e) {
+            text = fmt::format("Unable to format \"{}\": {}", message.format, e.what());
+        }
+        TraceMessage(message.log_class, message.log_level, text);
+        WriteEntry(Entry{
+            .timestamp = header.timestamp,
+            .log_class = message.log_class,
+            .log_level = message.log_level,
+            .filename = message.filename,
+            .line_num = message.line_num,
+            .function = message.function,
+            .message = std::move(text),
+            .thread = ring.thread_name,
+            .counter = 1,
+        });
+    }
+
+    /// Writes an entry from the backend thread, grouping identical messages if enabled.
+    void WriteEntry(Entry&& entry) {
+        if (!Config::groupIdenticalLogs()) {
+            ForEachBackend([&entry](auto& backend) { backend.Write(entry); });
+            return;
+        }
+        std::scoped_lock lock{_mutex};
+        if (_last_entry.message == entry.message) {
+            ++_last_entry.counter;
+            return;
+        }
+        WriteLastEntry();
+        _last_entry = std::move(entry);
+    }
+
+    void WriteLastEntry() {
+        if (_last_entry.counter >= 2) {
+            _last_entry.message += " x" + std::to_string(_last_entry.counter);
+        }
+        if (_last_entry.counter >= 1) {
+            ForEachBackend([this](auto& backend) { backend.Write(this->_last_entry); });
+        }
+        _last_entry = {};
+    }
+
+    void DeferredBackendLoop(std::stop_token stop_token) {
+        const auto wake = [this] {
+            backend_sleeping.store(false);
+            backend_sleeping.notify_one();
+        };
+        std::stop_callback wake_on_stop{stop_token, wake};
+        constexpr size_t BatchSize = 1024;
+        while (!stop_token.stop_requested()) {
+            if (DrainDeferred(BatchSize) != 0) {
+                continue;
+            }
+            backend_sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (HasDeferredMessages() || stop_token.stop_requested()) {
+                backend_sleeping.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            backend_sleeping.wait(true, std::memory_order_acquire);
+        }
+        // From here on new messages are written out by the threads logging them.
+        deferred_running.store(false, std::memory_order_relaxed);
+        // Only writes out up to 100 messages, same as the asynchronous drain below.
+        DrainDeferred(filter.IsDebug() ? std::numeric_limits<size_t>::max() : 100);
+    }
+
     void StartBackendThread() {
+        if (deferred) {
+            deferred_running.store(true, std::memory_order_relaxed);
+            backend_thread = std::jthread([this](std::stop_token stop_token) {
+                Common::SetCurrentThreadName("shadPS4:Log");
+                DeferredBackendLoop(stop_token);
+            });
+            return;
+        }
         backend_thread = std::jthread([this](std::stop_token stop_token) {
             Common::SetCurrentThreadName("shadPS4:Log");
             Entry entry;
@@ -296,7 +588,7 @@ private:
     }
 
     void StopBackendThread() {
-        if (Config::groupIdenticalLogs()) {
+        if (Config::groupIdenticalLogs() && !deferred) {
             // log last message
             if (_last_entry.counter >= 2) {
                 _last_entry.message += " x" + std::to_string(_last_entry.counter);
@@ -318,6 +610,10 @@ private:
         if (backend_thread.joinable()) {
             backend_thread.join();
         }
+        if (deferred && Config::groupIdenticalLogs()) {
+            std::scoped_lock lock{_mutex};
+            WriteLastEntry();
+        }
 
         ForEachBackend([](auto& backend) { backend.Flush(); });
     }
@@ -349,6 +645,14 @@ private:
     std::jthread backend_thread;
     Entry _last_entry;
     std::mutex _mutex;
+
+    const bool deferred;
+    const u64 instance_id{++next_instance_id};
+    std::atomic_bool deferred_running{};
+    std::atomic_bool backend_sleeping{};
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<DeferredRing>> rings;
+    std::vector<std::shared_ptr<DeferredRing>> drain_rings;
 };
 } // namespace
 
@@ -385,6 +689,21 @@ void SetAppend() {
     Impl::SetAppend();
 }
 
+LogPath GetLogPath(Class log_class, Level log_level) {
+    if (initialization_in_progress_suppress_logging) [[unlikely]] {
+        return LogPath::Disabled;
+    }
+    return Impl::Instance().GetLogPath(log_class, log_level);
+}
+
+u8* BeginDeferredMessage(const DeferredMessage& message, size_t args_size) {
+    return Impl::Instance().BeginDeferred(message, args_size);
+}
+
+void EndDeferredMessage() {
+    Impl::Instance().EndDeferred();
+}
+
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
                        const fmt::format_args& args) {
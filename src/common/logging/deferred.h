@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "common/logging/formatter.h"
+#include "common/logging/types.h"
+
+namespace Common::Log {
+
+/// Formats the packed arguments of a deferred message.
+using DeferredFormatFn = std::string (*)(const char* format, const u8* args);
+
+/// Call site information of a deferred message, everything it points to must be static.
+struct DeferredMessage {
+    Class log_class;
+    Level log_level;
+    u32 line_num;
+    const char* filename;
+    const char* function;
+    const char* format;
+    DeferredFormatFn format_fn;
+};
+
+/**
+ * Reserves room for a message and args_size bytes of packed arguments in the calling thread's log
+ * ring. Returns where the arguments go, or nullptr if the message has to be formatted right away.
+ */
+u8* BeginDeferredMessage(const DeferredMessage& message, size_t args_size);
+
+/// Publishes the message reserved by the last BeginDeferredMessage of this thread.
+void EndDeferredMessage();
+
+namespace Deferred {
+
+// Strings are copied into the ring, everything else that can be captured is a plain value.
+template <typename T>
+concept StringArg = std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view> ||
+                    std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+                    (std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, char>);
+
+template <typename T>
+concept ValueArg = std::is_arithmetic_v<T> || std::is_enum_v<T> ||
+                   std::is_same_v<T, const void*> || std::is_same_v<T, void*>;
+
+template <typename T>
+concept Capturable = StringArg<T> || ValueArg<T>;
+
+template <typename T>
+using StoredArg = std::conditional_t<StringArg<T>, std::string_view, T>;
+
+template <typename T>
+std::string_view ToStringView(const T& arg) {
+    if constexpr (std::is_pointer_v<T>) {
+        return arg ? std::string_view{arg} : std::string_view{};
+    } else {
+        return std::string_view{arg};
+    }
+}
+
+template <typename T>
+size_t ArgSize(const T& arg) {
+    if constexpr (StringArg<T>) {
+        return sizeof(u32) + ToStringView(arg).size();
+    } else {
+        return sizeof(T);
+    }
+}
+
+template <typename T>
+u8* WriteArg(u8* out, const T& arg) {
+    if constexpr (StringArg<T>) {
+        const auto str = ToStringView(arg);
+        const u32 size = static_cast<u32>(str.size());
+        std::memcpy(out, &size, sizeof(size));
+        std::memcpy(out + sizeof(size), str.data(), size);
+        return out + sizeof(size) + size;
+    } else {
+        std::memcpy(out, &arg, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template <typename T>
+StoredArg<T> ReadArg(const u8*& in) {
+    if constexpr (StringArg<T>) {
+        u32 size;
+        std::memcpy(&size, in, sizeof(size));
+        const std::string_view str{reinterpret_cast<const char*>(in + sizeof(size)), size};
+        in += sizeof(size) + size;
+        return str;
+    } else {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        in += sizeof(T);
+        return value;
+    }
+}
+
+template <typename... Args>
+std::string Format(const char* format, const u8* args) {
+    // Braced initialization reads the arguments in order.
+    const std::tuple<StoredArg<Args>...> values{ReadArg<Args>(args)...};
+    return std::apply(
+        [format](const auto&... values) {
+            return fmt::vformat(format, fmt::make_format_args(values...));
+        },
+        values);
+}
+
+template <typename... Args>
+bool Push(Class log_class, Level log_level, const char* filename, unsigned int line_num,
+          const char* function, const char* format, const Args&... args) {
+    const DeferredMessage message{
+        .log_class = log_class,
+        .log_level = log_level,
+        .line_num = line_num,
+        .filename = filename,
+        .function = function,
+        .format = format,
+        .format_fn = &Format<Args...>,
+    };
+    u8* out = BeginDeferredMessage(message, (size_t{0} + ... + ArgSize(args)));
+    if (!out) {
+        return false;
+    }
+    ((out = WriteArg(out, args)), ...);
+    EndDeferredMessage();
+    return true;
+}
+
+} // namespace Deferred
+
+} // namespace Common::Log
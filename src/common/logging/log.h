@@ -7,6 +7,7 @@
 #include <array>
 #include <string_view>
 
+#include "common/logging/deferred.h"
 #include "common/logging/formatter.h"
 #include "common/logging/types.h"
 
@@ -20,6 +21,15 @@ constexpr const char* TrimSourcePath(std::string_view source) {
     return source.data() + idx;
 }
 
+enum class LogPath : u8 {
+    Disabled,  ///< The message is filtered out.
+    Immediate, ///< The message is formatted by the calling thread.
+    Deferred,  ///< The arguments are captured and the backend thread formats the message.
+};
+
+/// Checks the filter and the logging mode, before any argument is looked at.
+LogPath GetLogPath(Class log_class, Level log_level);
+
 /// Logs a message to the global logger, using fmt
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
@@ -28,6 +38,16 @@ void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
 template <typename... Args>
 void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsigned int line_num,
                    const char* function, const char* format, const Args&... args) {
+    const LogPath path = GetLogPath(log_class, log_level);
+    if (path == LogPath::Disabled) {
+        return;
+    }
+    if constexpr ((Deferred::Capturable<Args> && ...)) {
+        if (path == LogPath::Deferred &&
+            Deferred::Push(log_class, log_level, filename, line_num, function, format, args...)) {
+            return;
+        }
+    }
     FmtLogMessageImpl(log_class, log_level, filename, line_num, function, format,
                       fmt::make_format_args(args...));
 }
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "common/types.h"
+
+namespace Common {
+
+// Like SharedFirstMutex, but readers register in one of several cache line sized shards picked
+// per thread, so concurrent readers do not bounce a shared counter between cores. Readers still
+// have priority over a waiting writer, which keeps recursive shared locking deadlock free.
+class ShardedSharedMutex {
+public:
+    struct Stats {
+        u64 shared_locks;
+        u64 shared_contended;
+        u64 exclusive_locks;
+        u64 exclusive_contended;
+        u64 exclusive_wait_ns;
+    };
+
+    void lock() {
+        writer_mutex.lock();
+        exclusive_locks.fetch_add(1, std::memory_order_relaxed);
+        if (TryAcquire()) {
+            return;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        do {
+            while (!AllReadersIdle()) {
+                std::this_thread::yield();
+            }
+        } while (!TryAcquire());
+        const auto wait = std::chrono::steady_clock::now() - start;
+        exclusive_contended.fetch_add(1, std::memory_order_relaxed);
+        exclusive_wait_ns.fetch_add(std::chrono::nanoseconds{wait}.count(),
+                                    std::memory_order_relaxed);
+    }
+
+    bool try_lock() {
+        if (!writer_mutex.try_lock()) {
+            return false;
+        }
+        if (!TryAcquire()) {
+            writer_mutex.unlock();
+            return false;
+        }
+        exclusive_locks.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() {
+        writer_active.store(false, std::memory_order_release);
+        writer_active.notify_all();
+        writer_mutex.unlock();
+    }
+
+    void lock_shared() {
+        Shard& shard = shards[ShardIndex()];
+        shard.readers.fetch_add(1, std::memory_order_seq_cst);
+        shard.shared_locks.fetch_add(1, std::memory_order_relaxed);
+        if (!writer_active.load(std::memory_order_seq_cst)) {
+            return;
+        }
+        shard.shared_contended.fetch_add(1, std::memory_order_relaxed);
+        do {
+            shard.readers.fetch_sub(1, std::memory_order_release);
+            writer_active.wait(true, std::memory_order_acquire);
+            shard.readers.fetch_add(1, std::memory_order_seq_cst);
+        } while (writer_active.load(std::memory_order_seq_cst));
+    }
+
+    void unlock_shared() {
+        shards[ShardIndex()].readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    Stats GetStats() const {
+        Stats stats{
+            .exclusive_locks = exclusive_locks.load(std::memory_order_relaxed),
+            .exclusive_contended = exclusive_contended.load(std::memory_order_relaxed),
+            .exclusive_wait_ns = exclusive_wait_ns.load(std::memory_order_relaxed),
+        };
+        for (const Shard& shard : shards) {
+            stats.shared_locks += shard.shared_locks.load(std::memory_order_relaxed);
+            stats.shared_contended += shard.shared_contended.load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    void ResetStats() {
+        exclusive_locks.store(0, std::memory_order_relaxed);
+        exclusive_contended.store(0, std::memory_order_relaxed);
+        exclusive_wait_ns.store(0, std::memory_order_relaxed);
+        for (Shard& shard : shards) {
+            shard.shared_locks.store(0, std::memory_order_relaxed);
+            shard.shared_contended.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    static constexpr size_t NumShards = 16;
+
+    struct alignas(64) Shard {
+        std::atomic<u32> readers;
+        std::atomic<u64> shared_locks;
+        std::atomic<u64> shared_contended;
+    };
+
+    static size_t ShardIndex() {
+        static std::atomic<size_t> next_index;
+        thread_local const size_t index = next_index++ % NumShards;
+        return index;
+    }
+
+    bool AllReadersIdle() const {
+        for (const Shard& shard : shards) {
+            if (shard.readers.load(std::memory_order_seq_cst) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Announces the writer and checks for readers, backing off while any holds the lock.
+    bool TryAcquire() {
+        writer_active.store(true, std::memory_order_seq_cst);
+        if (AllReadersIdle()) {
+            return true;
+        }
+        writer_active.store(false, std::memory_order_seq_cst);
+        writer_active.notify_all();
+        return false;
+    }
+
+    std::array<Shard, NumShards> shards{};
+    std::atomic_bool writer_active{};
+    std::mutex writer_mutex;
+    std::atomic<u64> exclusive_locks{};
+    std::atomic<u64> exclusive_contended{};
+    std::atomic<u64> exclusive_wait_ns{};
+};
+
+} // namespace Common
@@ -8,6 +8,9 @@
 #include "core/debug_state.h"
 #include "imgui.h"
 #include "imgui_internal.h"
+#include "video_core/amdgpu/liverpool.h"
+
+extern std::unique_ptr<AmdGpu::Liverpool> liverpool;
 
 using namespace ImGui;
 
@@ -69,6 +72,28 @@ void FrameGraph::DrawFrameGraph() {
     draw_list.PopClipRect();
 }
 
+void FrameGraph::DrawSubmitQueues() {
+    using AmdGpu::Liverpool;
+    constexpr auto to_us = [](u64 ns) { return static_cast<double>(ns) / 1000.0; };
+    for (u32 qid = 0; qid < Liverpool::NumTotalQueues; ++qid) {
+        const auto stats = liverpool->GetSubmitQueueStats(qid);
+        if (stats.num_submits == 0) {
+            continue;
+        }
+        const double num_submits = static_cast<double>(stats.num_submits);
+        if (qid == Liverpool::GfxQueueId) {
+            Text("GFX: %llu submits", static_cast<unsigned long long>(stats.num_submits));
+        } else {
+            Text("ASC %u: %llu submits", qid - 1,
+                 static_cast<unsigned long long>(stats.num_submits));
+        }
+        Text("  enqueue: %.2f us avg, %.2f us max", to_us(stats.enqueue_ns_total) / num_submits,
+             to_us(stats.enqueue_ns_max));
+        Text("  dequeue: %.2f us avg, %.2f us max", to_us(stats.dequeue_ns_total) / num_submits,
+             to_us(stats.dequeue_ns_max));
+    }
+}
+
 void FrameGraph::Draw() {
     if (!is_open) {
         return;
@@ -101,6 +126,11 @@ void FrameGraph::Draw() {
         Text("Output Res: %dx%d", DebugState.output_resolution.first,
              DebugState.output_resolution.second);
         Text("FSR: %s", DebugState.is_using_fsr ? "on" : "off");
+
+        if (liverpool) {
+            SeparatorText("Submit queues");
+            DrawSubmitQueues();
+        }
     }
     End();
 }
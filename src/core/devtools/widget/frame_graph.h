@@ -20,6 +20,7 @@ class FrameGraph {
     float frameRate{};
 
     void DrawFrameGraph();
+    void DrawSubmitQueues();
 
 public:
     bool is_open = true;
@@ -2,6 +2,7 @@
 //  SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cinttypes>
+#include <shared_mutex>
 #include <imgui.h>
 #include <magic_enum/magic_enum.hpp>
 
@@ -62,6 +63,19 @@ bool MemoryMapViewer::Iterator::DrawLine() {
     return true;
 }
 
+void MemoryMapViewer::DrawLockStats(Common::ShardedSharedMutex& mutex) {
+    const auto stats = mutex.GetStats();
+    Text("Shared locks: %" PRIu64 " (%" PRIu64 " contended)", stats.shared_locks,
+         stats.shared_contended);
+    Text("Exclusive locks: %" PRIu64 " (%" PRIu64 " contended, %.3f ms waited)",
+         stats.exclusive_locks, stats.exclusive_contended, stats.exclusive_wait_ns / 1e6);
+    SameLine();
+    if (SmallButton("Reset")) {
+        mutex.ResetStats();
+    }
+    Separator();
+}
+
 void MemoryMapViewer::Draw() {
     SetNextWindowSize({600.0f, 500.0f}, ImGuiCond_FirstUseEver);
     if (!Begin("Memory map", &open)) {
@@ -70,7 +84,8 @@ void MemoryMapViewer::Draw() {
     }
 
     auto mem = Memory::Instance();
-    std::scoped_lock lck{mem->mutex};
+    DrawLockStats(mem->mutex);
+    std::shared_lock lck{mem->mutex};
 
     {
         bool next_showing_vma = showing_vma;
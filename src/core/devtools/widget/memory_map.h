@@ -24,6 +24,8 @@ class MemoryMapViewer {
 
     bool showing_vma = true;
 
+    static void DrawLockStats(Common::ShardedSharedMutex& mutex);
+
 public:
     bool open = false;
 
@@ -6,6 +6,7 @@
 #include "shader_list.h"
 
 #include <imgui.h>
+#include <nlohmann/json.hpp>
 
 #include "common.h"
 #include "common/config.h"
@@ -24,6 +25,32 @@ using namespace ImGui;
 
 namespace Core::Devtools::Widget {
 
+static void DrawPassTimings(std::span<const Shader::PassTiming> timings) {
+    if (!BeginTable("##pass_timings", 4,
+                    ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+                    {0.0f, 200.0f})) {
+        return;
+    }
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Pass");
+    TableSetupColumn("Time (us)");
+    TableSetupColumn("Instructions");
+    TableSetupColumn("Blocks");
+    TableHeadersRow();
+    for (const auto& timing : timings) {
+        TableNextRow();
+        TableNextColumn();
+        TextUnformatted(timing.name.data(), timing.name.data() + timing.name.size());
+        TableNextColumn();
+        Text("%.1f", static_cast<double>(timing.time_ns) / 1000.0);
+        TableNextColumn();
+        Text("%u -> %u", timing.insts_before, timing.insts_after);
+        TableNextColumn();
+        Text("%u", timing.num_blocks);
+    }
+    EndTable();
+}
+
 ShaderList::Selection::Selection(int index)
     : index(index), isa_editor(std::make_unique<TextEditor>()),
       glsl_editor(std::make_unique<TextEditor>()) {
@@ -217,6 +244,10 @@ bool ShaderList::Selection::DrawShader(DebugStateType::ShaderDump& value) {
         }
     }
 
+    if (!value.pass_timings.empty() && CollapsingHeader("Recompiler passes")) {
+        DrawPassTimings(value.pass_timings);
+    }
+
     if (showing_bin) {
         isa_editor->Render(value.is_patched ? "SPIRV" : "ISA", GetContentRegionAvail());
     } else {
@@ -227,6 +258,91 @@ bool ShaderList::Selection::DrawShader(DebugStateType::ShaderDump& value) {
     return open;
 }
 
+void ShaderList::DrawPassProfile() {
+    const auto& shaders = DebugState.shader_dump_list;
+    for (; num_profiled_shaders < shaders.size(); ++num_profiled_shaders) {
+        pass_profile.Add(shaders[num_profiled_shaders].pass_timings);
+    }
+    if (pass_profile.num_shaders == 0 || !CollapsingHeader("Recompiler pass profile")) {
+        return;
+    }
+
+    const double total_ms = static_cast<double>(pass_profile.total_time_ns) / 1e6;
+    Text("%u shaders, %.2f ms total (%.3f ms avg)", pass_profile.num_shaders, total_ms,
+         total_ms / pass_profile.num_shaders);
+    SameLine();
+    if (Button("Dump JSON")) {
+        DumpPassProfile();
+    }
+
+    if (!BeginTable("##pass_profile", 5,
+                    ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+                    {0.0f, 250.0f})) {
+        return;
+    }
+    TableSetupScrollFreeze(0, 1);
+    TableSetupColumn("Pass");
+    TableSetupColumn("Total (ms)");
+    TableSetupColumn("Share");
+    TableSetupColumn("Max (us)");
+    TableSetupColumn("IR delta");
+    TableHeadersRow();
+    for (const auto& entry : pass_profile.entries) {
+        TableNextRow();
+        TableNextColumn();
+        TextUnformatted(entry.name.data(), entry.name.data() + entry.name.size());
+        TableNextColumn();
+        Text("%.3f", static_cast<double>(entry.time_ns) / 1e6);
+        TableNextColumn();
+        Text("%.1f%%", 100.0 * entry.time_ns / pass_profile.total_time_ns);
+        TableNextColumn();
+        Text("%.1f", static_cast<double>(entry.max_time_ns) / 1000.0);
+        TableNextColumn();
+        Text("%lld", static_cast<long long>(entry.inst_delta));
+    }
+    EndTable();
+}
+
+void ShaderList::DumpPassProfile() const {
+    nlohmann::json summary = nlohmann::json::array();
+    for (const auto& entry : pass_profile.entries) {
+        summary.push_back({
+            {"name", entry.name},
+            {"runs", entry.num_runs},
+            {"time_ns", entry.time_ns},
+            {"max_time_ns", entry.max_time_ns},
+            {"inst_delta", entry.inst_delta},
+        });
+    }
+    nlohmann::json shaders = nlohmann::json::array();
+    for (const auto& shader : DebugState.shader_dump_list) {
+        nlohmann::json passes = nlohmann::json::array();
+        for (const auto& timing : shader.pass_timings) {
+            passes.push_back({
+                {"name", timing.name},
+                {"time_ns", timing.time_ns},
+                {"insts_before", timing.insts_before},
+                {"insts_after", timing.insts_after},
+                {"blocks", timing.num_blocks},
+            });
+        }
+        shaders.push_back({{"name", shader.name}, {"passes", std::move(passes)}});
+    }
+    const nlohmann::json profile{
+        {"num_shaders", pass_profile.num_shaders},
+        {"total_time_ns", pass_profile.total_time_ns},
+        {"passes", std::move(summary)},
+        {"shaders", std::move(shaders)},
+    };
+
+    const auto path = Common::FS::GetUserPath(Common::FS::PathType::ShaderDir) /
+                      "pass_profile.json";
+    std::ofstream file{path, std::ios::trunc};
+    file << profile.dump(4);
+    DebugState.ShowDebugMessage(fmt::format("Pass profile saved to {}",
+                                            Common::U8stringToString(path.u8string())));
+}
+
 void ShaderList::Draw() {
     for (auto it = open_shaders.begin(); it != open_shaders.end();) {
         auto& selection = *it;
@@ -250,6 +366,8 @@ void ShaderList::Draw() {
         return;
     }
 
+    DrawPassProfile();
+
     InputTextEx("##search_shader", "Search by name", search_box, sizeof(search_box), {},
                 ImGuiInputTextFlags_None);
 
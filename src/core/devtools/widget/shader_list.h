@@ -36,6 +36,13 @@ class ShaderList {
 
     char search_box[128]{};
 
+    Shader::PassProfile pass_profile{};
+    size_t num_profiled_shaders{};
+
+    void DrawPassProfile();
+
+    void DumpPassProfile() const;
+
 public:
     bool open = false;
 
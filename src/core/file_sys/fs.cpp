@@ -25,7 +25,17 @@ void MntPoints::Mount(const std::filesystem::path& host_folder, const std::strin
                       bool read_only) {
     std::scoped_lock lock{m_mutex};
     const auto guest_folder_sanitized = RemoveTrailingSlashes(guest_folder);
-    m_mnt_pairs.emplace_back(host_folder, guest_folder_sanitized, read_only);
+    std::filesystem::path patch_path = host_folder;
+    patch_path += "-UPDATE";
+    if (!std::filesystem::exists(patch_path)) {
+        patch_path = host_folder;
+        patch_path += "-patch";
+        if (!std::filesystem::exists(patch_path)) {
+            patch_path.clear();
+        }
+    }
+    m_mnt_pairs.emplace_back(host_folder, guest_folder_sanitized, read_only, patch_path);
+    ClearCaches();
 }
 
 void MntPoints::Unmount(const std::filesystem::path& host_folder, const std::string& guest_folder) {
@@ -35,11 +45,13 @@ void MntPoints::Unmount(const std::filesystem::path& host_folder, const std::str
         return pair.mount == guest_folder_sanitized;
     });
     m_mnt_pairs.erase(it, m_mnt_pairs.end());
+    ClearCaches();
 }
 
 void MntPoints::UnmountAll() {
     std::scoped_lock lock{m_mutex};
     m_mnt_pairs.clear();
+    ClearCaches();
 }
 
 std::filesystem::path MntPoints::GetHostPath(std::string_view path, bool* is_read_only,
@@ -70,90 +82,156 @@ std::filesystem::path MntPoints::GetHostPath(std::string_view path, bool* is_rea
         return mount->host_path;
     }
 
+    const bool use_patch =
+        (corrected_path.starts_with("/app0") || corrected_path.starts_with("/hostapp")) &&
+        !force_base_path && !ignore_game_patches && !mount->patch_path.empty();
+    auto& resolved = m_resolved[use_patch];
+    u64 generation;
+    {
+        std::shared_lock lk{m_resolved_mutex};
+        if (const auto it = resolved.find(corrected_path); it != resolved.end()) {
+            return it->second;
+        }
+        generation = m_resolved_generation;
+    }
+
     // Remove device (e.g /app0) from path to retrieve relative path.
     const auto rel_path = std::string_view{corrected_path}.substr(mount->mount.size() + 1);
-    std::filesystem::path host_path = mount->host_path / rel_path;
-    std::filesystem::path patch_path = mount->host_path;
-    patch_path += "-UPDATE";
-    if (!std::filesystem::exists(patch_path)) {
-        patch_path = mount->host_path;
-        patch_path += "-patch";
+    bool found;
+    auto host_path = ResolveHostPath(*mount, rel_path, use_patch, found);
+
+    // Paths that do not exist yet are only remembered where nothing can create them.
+    if (found || mount->read_only) {
+        std::scoped_lock lk{m_resolved_mutex};
+        if (generation == m_resolved_generation) {
+            resolved.emplace(std::move(corrected_path), host_path);
+        }
     }
-    patch_path /= rel_path;
+    return host_path;
+}
 
-    if ((corrected_path.starts_with("/app0") || corrected_path.starts_with("/hostapp")) &&
-        !force_base_path && !ignore_game_patches && std::filesystem::exists(patch_path)) {
-        return patch_path;
+std::filesystem::path MntPoints::ResolveHostPath(const MntPair& mount, std::string_view rel_path,
+                                                 bool use_patch, bool& found) {
+    found = true;
+    if (use_patch) {
+        if (auto path = FindHostPath(mount.patch_path, rel_path, !mount.read_only)) {
+            return *path;
+        }
     }
+    if (auto path = FindHostPath(mount.host_path, rel_path, !mount.read_only)) {
+        return *path;
+    }
+
+    // Opening the guest path will surely fail but at least gives
+    // a better error message than the empty path.
+    found = false;
+    return mount.host_path / rel_path;
+}
 
+std::optional<std::filesystem::path> MntPoints::FindHostPath(const std::filesystem::path& root,
+                                                             std::string_view rel_path,
+                                                             bool refresh) {
     if (!NeedsCaseInsensitiveSearch) {
+        auto host_path = root / rel_path;
+        if (!std::filesystem::exists(host_path)) {
+            return std::nullopt;
+        }
         return host_path;
     }
 
-    const auto search = [&](const auto host_path) {
-        // If the path does not exist attempt to verify this.
-        // Retrieve parent path until we find one that exists.
-        std::scoped_lock lk{m_mutex};
-        path_parts.clear();
-        auto current_path = host_path;
-        while (!std::filesystem::exists(current_path)) {
-            // We have probably cached this if it's a folder.
-            if (auto it = path_cache.find(current_path); it != path_cache.end()) {
-                current_path = it->second;
-                break;
-            }
-            path_parts.emplace_back(current_path.filename());
-            current_path = current_path.parent_path();
+    // Walk the relative path through the directory indices, which match each part
+    // either exactly or in a case insensitive manner.
+    std::scoped_lock lk{m_dir_index_mutex};
+    auto current_path = root;
+    for (const auto& part : std::filesystem::path{rel_path}) {
+        const auto name = part.string();
+        if (name.empty()) {
+            continue;
         }
-        // We have found an anchor. Traverse parts we recoded and see if they
-        // exist in filesystem but in different case.
-        auto guest_path = current_path;
-        while (!path_parts.empty()) {
-            const auto part = path_parts.back();
-            const auto add_match = [&](const auto& host_part) {
-                current_path /= host_part;
-                guest_path /= part;
-                path_cache[guest_path] = current_path;
-                path_parts.pop_back();
-            };
-            // Can happen when the mismatch is in upper folder.
-            if (std::filesystem::exists(current_path / part)) {
-                add_match(part);
-                continue;
-            }
-            const auto part_low = Common::ToLower(part.string());
-            bool found_match = false;
-            for (const auto& path : std::filesystem::directory_iterator(current_path)) {
-                const auto candidate = path.path().filename();
-                const auto filename = Common::ToLower(candidate.string());
-                // Check if a filename matches in case insensitive manner.
-                if (filename != part_low) {
-                    continue;
-                }
-                // We found a match, record the actual path in the cache.
-                add_match(candidate);
-                found_match = true;
-                break;
-            }
-            if (!found_match) {
-                return std::optional<std::filesystem::path>({});
-            }
+        if (name == "." || name == "..") {
+            current_path /= part;
+            continue;
+        }
+        const auto host_name = FindEntry(current_path, name, refresh);
+        if (!host_name) {
+            return std::nullopt;
+        }
+        current_path /= *host_name;
+    }
+    return current_path;
+}
+
+std::optional<std::string> MntPoints::FindEntry(const std::filesystem::path& directory,
+                                                const std::string& name, bool refresh) {
+    const auto build_index = [&] {
+        DirectoryIndex index;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec)) {
+            auto host_name = entry.path().filename().string();
+            index[Common::ToLower(host_name)].emplace_back(std::move(host_name));
         }
-        return std::optional<std::filesystem::path>(current_path);
+        return m_dir_index.insert_or_assign(directory, std::move(index)).first;
+    };
+    const auto find = [&](const DirectoryIndex& index) -> std::optional<std::string> {
+        const auto it = index.find(Common::ToLower(name));
+        if (it == index.end()) {
+            return std::nullopt;
+        }
+        // Prefer the exact name when several entries only differ in case.
+        const auto& host_names = it->second;
+        if (std::ranges::find(host_names, name) != host_names.end()) {
+            return name;
+        }
+        return host_names.front();
     };
 
-    if (!force_base_path && !ignore_game_patches) {
-        if (const auto path = search(patch_path)) {
-            return *path;
+    auto it = m_dir_index.find(directory);
+    if (it == m_dir_index.end()) {
+        return find(build_index()->second);
+    }
+    if (auto host_name = find(it->second)) {
+        return host_name;
+    }
+    // Writable mounts may have gained the entry from outside the guest, so rescan on a miss.
+    if (!refresh) {
+        return std::nullopt;
+    }
+    return find(build_index()->second);
+}
+
+void MntPoints::InvalidateHostPath(const std::filesystem::path& host_path) {
+    ClearResolvedPaths();
+    if (!NeedsCaseInsensitiveSearch) {
+        return;
+    }
+    std::scoped_lock lk{m_dir_index_mutex};
+    m_dir_index.erase(host_path.parent_path());
+    // Anything indexed below a removed or renamed directory is stale as well.
+    const auto& prefix = host_path.native();
+    for (auto it = m_dir_index.begin(); it != m_dir_index.end();) {
+        const auto& directory = it->first.native();
+        if (directory.starts_with(prefix) &&
+            (directory.size() == prefix.size() ||
+             directory[prefix.size()] == std::filesystem::path::preferred_separator)) {
+            it = m_dir_index.erase(it);
+        } else {
+            ++it;
         }
     }
-    if (const auto path = search(host_path)) {
-        return *path;
+}
+
+void MntPoints::ClearResolvedPaths() {
+    std::scoped_lock lk{m_resolved_mutex};
+    for (auto& resolved : m_resolved) {
+        resolved.clear();
     }
+    ++m_resolved_generation;
+}
 
-    // Opening the guest path will surely fail but at least gives
-    // a better error message than the empty path.
-    return host_path;
+void MntPoints::ClearCaches() {
+    ClearResolvedPaths();
+    std::scoped_lock lk{m_dir_index_mutex};
+    m_dir_index.clear();
 }
 
 // TODO: Does not handle mount points inside mount points.
@@ -168,28 +246,31 @@ void MntPoints::IterateDirectory(std::string_view guest_directory,
     callback(base_path / ".", false);
     callback(base_path / "..", false);
 
+    // List the patch directory once instead of probing it for every base entry.
+    std::map<std::filesystem::path, bool> patch_entries;
+    if (apply_patch) {
+        for (const auto& entry : std::filesystem::directory_iterator(patch_path)) {
+            patch_entries.emplace(entry.path().filename(), !entry.is_directory());
+        }
+    }
+
     // Pass 1: Any files that existed in the base directory, using patch directory if needed.
     if (std::filesystem::exists(base_path)) {
         for (const auto& entry : std::filesystem::directory_iterator(base_path)) {
-            if (apply_patch) {
-                const auto patch_entry_path = patch_path / entry.path().filename();
-                if (std::filesystem::exists(patch_entry_path)) {
-                    callback(patch_entry_path, !std::filesystem::is_directory(patch_entry_path));
-                    continue;
-                }
+            const auto filename = entry.path().filename();
+            if (const auto it = patch_entries.find(filename); it != patch_entries.end()) {
+                callback(patch_path / filename, it->second);
+                // Whatever remains afterwards only exists in the patch directory.
+                patch_entries.erase(it);
+                continue;
             }
             callback(entry.path(), !entry.is_directory());
         }
     }
 
     // Pass 2: Any files that exist only in the patch directory.
-    if (apply_patch) {
-        for (const auto& entry : std::filesystem::directory_iterator(patch_path)) {
-            const auto base_entry_path = base_path / entry.path().filename();
-            if (!std::filesystem::exists(base_entry_path)) {
-                callback(entry.path(), !entry.is_directory());
-            }
-        }
+    for (const auto& [filename, is_file] : patch_entries) {
+        callback(patch_path / filename, is_file);
     }
 }
 
@@ -300,4 +381,20 @@ int HandleTable::GetFileDescriptor(File* file) {
     return 0;
 }
 
+std::shared_ptr<const Common::FS::MappedFile> HandleTable::GetMappedFile(
+    const std::filesystem::path& host_name) {
+    std::scoped_lock lock{m_mapped_files_mutex};
+    auto& entry = m_mapped_files[host_name];
+    if (auto mapping = entry.lock()) {
+        return mapping;
+    }
+    auto mapping = std::make_shared<const Common::FS::MappedFile>(host_name);
+    if (!mapping->IsOpen()) {
+        m_mapped_files.erase(host_name);
+        return nullptr;
+    }
+    entry = mapping;
+    return mapping;
+}
+
 } // namespace Core::FileSys
@@ -3,8 +3,13 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 #include <tsl/robin_map.h>
@@ -33,6 +38,7 @@ public:
         std::filesystem::path host_path;
         std::string mount; // e.g /app0
         bool read_only;
+        std::filesystem::path patch_path{}; // update folder of the mount, empty if there is none
     };
 
     explicit MntPoints() = default;
@@ -50,6 +56,9 @@ public:
     void IterateDirectory(std::string_view guest_directory,
                           const IterateDirectoryCallback& callback);
 
+    /// Drops cached lookups that may have changed after the host path was created or removed.
+    void InvalidateHostPath(const std::filesystem::path& host_path);
+
     const MntPair* GetMountFromHostPath(const std::string& host_path) {
         std::scoped_lock lock{m_mutex};
         const auto it = std::ranges::find_if(m_mnt_pairs, [&](const MntPair& mount) {
@@ -69,10 +78,26 @@ public:
     }
 
 private:
+    // Host names of a directory's entries, keyed by their lower case name.
+    using DirectoryIndex = tsl::robin_map<std::string, std::vector<std::string>>;
+
+    std::filesystem::path ResolveHostPath(const MntPair& mount, std::string_view rel_path,
+                                          bool use_patch, bool& found);
+    std::optional<std::filesystem::path> FindHostPath(const std::filesystem::path& root,
+                                                      std::string_view rel_path, bool refresh);
+    std::optional<std::string> FindEntry(const std::filesystem::path& directory,
+                                         const std::string& name, bool refresh);
+    void ClearResolvedPaths();
+    void ClearCaches();
+
     std::vector<MntPair> m_mnt_pairs;
-    std::vector<std::filesystem::path> path_parts;
-    tsl::robin_map<std::filesystem::path, std::filesystem::path> path_cache;
     std::mutex m_mutex;
+    // Resolved host paths of guest paths, with and without the patch folder applied.
+    std::array<tsl::robin_map<std::string, std::filesystem::path>, 2> m_resolved;
+    u64 m_resolved_generation{};
+    std::shared_mutex m_resolved_mutex;
+    tsl::robin_map<std::filesystem::path, DirectoryIndex> m_dir_index;
+    std::mutex m_dir_index_mutex;
 };
 
 enum class FileType {
@@ -90,6 +115,8 @@ struct File {
     std::filesystem::path m_host_name;
     std::string m_guest_name;
     Common::FS::IOFile f;
+    // Shared mapping that positional reads are served from, only set for read-only game files.
+    std::shared_ptr<const Common::FS::MappedFile> mapping;
     std::mutex m_mutex;
     std::shared_ptr<Directories::BaseDirectory> directory; // only valid for type == Directory
     std::shared_ptr<Devices::BaseDevice> device;           // only valid for type == Device
@@ -112,11 +139,17 @@ public:
     File* GetFile(const std::filesystem::path& host_name);
     int GetFileDescriptor(File* file);
 
+    /// Returns the mapping of a host file, shared by all of its handles that are open at once.
+    std::shared_ptr<const Common::FS::MappedFile> GetMappedFile(
+        const std::filesystem::path& host_name);
+
     void CreateStdHandles();
 
 private:
     std::vector<File*> m_files;
     std::mutex m_mutex;
+    std::map<std::filesystem::path, std::weak_ptr<const Common::FS::MappedFile>> m_mapped_files;
+    std::mutex m_mapped_files_mutex;
 };
 
 } // namespace Core::FileSys
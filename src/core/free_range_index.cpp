@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include "common/alignment.h"
+#include "common/assert.h"
+#include "core/free_range_index.h"
+
+namespace Core {
+
+void FreeRangeIndex::Insert(VAddr base, u64 size) {
+    const u32 node = AllocateNode(base, size);
+    u32 left, right;
+    Split(root, base, left, right);
+    root = Merge(Merge(left, node), right);
+    ++num_ranges;
+}
+
+void FreeRangeIndex::Erase(VAddr base) {
+    root = EraseImpl(root, base);
+}
+
+void FreeRangeIndex::Resize(VAddr base, u64 size) {
+    const bool found = ResizeImpl(root, base, size);
+    ASSERT_MSG(found, "Free range {:#x} is not indexed", base);
+}
+
+std::optional<VAddr> FreeRangeIndex::FindFirstFit(VAddr min_base, u64 size, u64 alignment) const {
+    return FindImpl(root, min_base, size, alignment);
+}
+
+u32 FreeRangeIndex::AllocateNode(VAddr base, u64 size) {
+    // Xorshift is plenty to keep the treap balanced.
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    const Node node{base, size, size, seed, Nil, Nil};
+    if (free_nodes.empty()) {
+        nodes.push_back(node);
+        return static_cast<u32>(nodes.size() - 1);
+    }
+    const u32 index = free_nodes.back();
+    free_nodes.pop_back();
+    nodes[index] = node;
+    return index;
+}
+
+void FreeRangeIndex::Update(u32 node) {
+    Node& n = nodes[node];
+    n.max_size = n.size;
+    if (n.left != Nil) {
+        n.max_size = std::max(n.max_size, nodes[n.left].max_size);
+    }
+    if (n.right != Nil) {
+        n.max_size = std::max(n.max_size, nodes[n.right].max_size);
+    }
+}
+
+void FreeRangeIndex::Split(u32 node, VAddr base, u32& left, u32& right) {
+    if (node == Nil) {
+        left = right = Nil;
+        return;
+    }
+    if (nodes[node].base < base) {
+        Split(nodes[node].right, base, nodes[node].right, right);
+        left = node;
+    } else {
+        Split(nodes[node].left, base, left, nodes[node].left);
+        right = node;
+    }
+    Update(node);
+}
+
+u32 FreeRangeIndex::Merge(u32 left, u32 right) {
+    if (left == Nil) {
+        return right;
+    }
+    if (right == Nil) {
+        return left;
+    }
+    if (nodes[left].priority > nodes[right].priority) {
+        nodes[left].right = Merge(nodes[left].right, right);
+        Update(left);
+        return left;
+    }
+    nodes[right].left = Merge(left, nodes[right].left);
+    Update(right);
+    return right;
+}
+
+u32 FreeRangeIndex::EraseImpl(u32 node, VAddr base) {
+    ASSERT_MSG(node != Nil, "Free range {:#x} is not indexed", base);
+    Node& n = nodes[node];
+    if (n.base == base) {
+        const u32 merged = Merge(n.left, n.right);
+        free_nodes.push_back(node);
+        --num_ranges;
+        return merged;
+    }
+    if (base < n.base) {
+        n.left = EraseImpl(n.left, base);
+    } else {
+        n.right = EraseImpl(n.right, base);
+    }
+    Update(node);
+    return node;
+}
+
+bool FreeRangeIndex::ResizeImpl(u32 node, VAddr base, u64 size) {
+    if (node == Nil) {
+        return false;
+    }
+    Node& n = nodes[node];
+    if (n.base == base) {
+        n.size = size;
+    } else if (!ResizeImpl(base < n.base ? n.left : n.right, base, size)) {
+        return false;
+    }
+    Update(node);
+    return true;
+}
+
+std::optional<VAddr> FreeRangeIndex::FindImpl(u32 node, VAddr min_base, u64 size,
+                                              u64 alignment) const {
+    if (node == Nil || nodes[node].max_size < size) {
+        return std::nullopt;
+    }
+    const Node& n = nodes[node];
+    if (n.base >= min_base) {
+        // Lower ranges come first, the left subtree is only worth visiting in this case.
+        if (const auto addr = FindImpl(n.left, min_base, size, alignment)) {
+            return addr;
+        }
+        const VAddr addr = Common::AlignUp(n.base, alignment);
+        const VAddr end = n.base + n.size;
+        if (addr <= end && end - addr >= size) {
+            return addr;
+        }
+    }
+    return FindImpl(n.right, min_base, size, alignment);
+}
+
+} // namespace Core
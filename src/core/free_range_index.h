@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "common/types.h"
+
+namespace Core {
+
+/**
+ * Address ordered set of free virtual ranges. Each subtree tracks the size of its largest range,
+ * so the lowest range above an address that can hold an aligned allocation is found without
+ * visiting the ranges too small for it.
+ */
+class FreeRangeIndex {
+public:
+    FreeRangeIndex() = default;
+
+    /// Adds a free range starting at base. The base must not be in the index.
+    void Insert(VAddr base, u64 size);
+
+    /// Removes the free range starting at base.
+    void Erase(VAddr base);
+
+    /// Changes the size of the free range starting at base.
+    void Resize(VAddr base, u64 size);
+
+    /**
+     * Finds the lowest range with a base at or above min_base that can hold size bytes at the
+     * given alignment.
+     * @returns The aligned address of the allocation, or nullopt if no range fits.
+     */
+    std::optional<VAddr> FindFirstFit(VAddr min_base, u64 size, u64 alignment) const;
+
+    size_t Size() const noexcept {
+        return num_ranges;
+    }
+
+private:
+    static constexpr u32 Nil = ~0U;
+
+    struct Node {
+        VAddr base;
+        u64 size;
+        u64 max_size;
+        u32 priority;
+        u32 left;
+        u32 right;
+    };
+
+    u32 AllocateNode(VAddr base, u64 size);
+    void Update(u32 node);
+    void Split(u32 node, VAddr base, u32& left, u32& right);
+    u32 Merge(u32 left, u32 right);
+    u32 EraseImpl(u32 node, VAddr base);
+    bool ResizeImpl(u32 node, VAddr base, u64 size);
+    std::optional<VAddr> FindImpl(u32 node, VAddr min_base, u64 size, u64 alignment) const;
+
+    std::vector<Node> nodes;
+    std::vector<u32> free_nodes;
+    u32 root{Nil};
+    u32 seed{0x9E3779B9};
+    size_t num_ranges{};
+};
+
+} // namespace Core
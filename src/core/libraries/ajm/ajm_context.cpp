@@ -13,8 +13,11 @@
 #include "core/libraries/ajm/ajm_mp3.h"
 #include "core/libraries/error_codes.h"
 
+#include <algorithm>
+#include <chrono>
 #include <span>
 #include <utility>
+#include <fmt/format.h>
 
 namespace Libraries::Ajm {
 
@@ -22,6 +25,14 @@ constexpr u32 ORBIS_AJM_WAIT_INFINITE = -1;
 constexpr int INSTANCE_ID_MASK = 0x3FFF;
 
 AjmContext::AjmContext() {
+    // The batch thread decodes as well, the pool only adds helpers for batches that feed several
+    // instances. Keep it small, audio shares the CPU with the game threads.
+    const u32 num_decoders = std::clamp(std::thread::hardware_concurrency() / 4, 1U, 4U);
+    AjmInstanceStatistics::Getinstance().SetNumDecoders(num_decoders + 1);
+    for (u32 i = 0; i < num_decoders; ++i) {
+        decoder_threads.emplace_back(
+            [this, i](std::stop_token stop) { this->DecoderThread(stop, i); });
+    }
     worker_thread = std::jthread([this](std::stop_token stop) { this->WorkerThread(stop); });
 }
 
@@ -73,25 +84,96 @@ void AjmContext::WorkerThread(std::stop_token stop) {
     }
 }
 
+void AjmContext::DecoderThread(std::stop_token stop, u32 index) {
+    Common::SetCurrentThreadName(fmt::format("shadPS4:AjmDecoder{}", index).c_str());
+    u64 seen_generation = 0;
+    while (!stop.stop_requested()) {
+        std::shared_ptr<BatchWork> work;
+        {
+            std::unique_lock lock{work_mutex};
+            Common::CondvarWait(work_cv, lock, stop,
+                                [&] { return work_generation != seen_generation; });
+            if (stop.stop_requested()) {
+                break;
+            }
+            seen_generation = work_generation;
+            work = current_work;
+        }
+        if (work) {
+            RunJobGroups(*work);
+        }
+    }
+}
+
+void AjmContext::RunJobGroups(BatchWork& work) {
+    using Clock = std::chrono::steady_clock;
+    auto& statistics = AjmInstanceStatistics::Getinstance();
+    // Decoders claim whole instances, so the jobs of an instance always run in order on one thread.
+    for (size_t i = work.next_group++; i < work.groups.size(); i = work.next_group++) {
+        JobGroup& group = work.groups[i];
+        for (AjmJob* job : group.jobs) {
+            const auto start = Clock::now();
+            group.instance->ExecuteJob(*job);
+            statistics.RecordDecode(group.codec_type, Clock::now() - start);
+        }
+        if (work.groups_left.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            work.groups_left.notify_one();
+        }
+    }
+}
+
 void AjmContext::ProcessBatch(u32 id, std::span<AjmJob> jobs) {
-    // Perform operation requested by control flags.
-    for (auto& job : jobs) {
-        LOG_TRACE(Lib_Ajm, "Processing job {} for instance {}. flags = {:#x}", id, job.instance_id,
-                  job.flags.raw);
-
-        if (job.instance_id == AJM_INSTANCE_STATISTICS) {
-            AjmInstanceStatistics::Getinstance().ExecuteJob(job);
-        } else {
-            std::shared_ptr<AjmInstance> instance;
-            {
-                std::shared_lock lock(instances_mutex);
-                auto* p_instance = instances.Get(job.instance_id & INSTANCE_ID_MASK);
+    auto work = std::make_shared<BatchWork>();
+    std::vector<AjmJob*> statistics_jobs;
+    {
+        std::shared_lock lock(instances_mutex);
+        for (auto& job : jobs) {
+            LOG_TRACE(Lib_Ajm, "Processing job {} for instance {}. flags = {:#x}", id,
+                      job.instance_id, job.flags.raw);
+
+            if (job.instance_id == AJM_INSTANCE_STATISTICS) {
+                statistics_jobs.push_back(&job);
+                continue;
+            }
+            const u32 instance_index = job.instance_id & INSTANCE_ID_MASK;
+            auto group = std::ranges::find(work->groups, instance_index, &JobGroup::instance_index);
+            if (group == work->groups.end()) {
+                auto* p_instance = instances.Get(instance_index);
                 ASSERT_MSG(p_instance != nullptr, "Attempting to execute job on null instance");
-                instance = *p_instance;
+                group = work->groups.insert(
+                    work->groups.end(),
+                    JobGroup{
+                        .instance_index = instance_index,
+                        .codec_type = static_cast<AjmCodecType>(job.instance_id >> 14),
+                        .instance = *p_instance,
+                    });
             }
+            group->jobs.push_back(&job);
+        }
+    }
 
-            instance->ExecuteJob(job);
+    // Perform operation requested by control flags.
+    work->groups_left = work->groups.size();
+    if (work->groups.size() > 1) {
+        {
+            std::scoped_lock lock{work_mutex};
+            current_work = work;
+            ++work_generation;
         }
+        work_cv.notify_all();
+    }
+    RunJobGroups(*work);
+    for (size_t left = work->groups_left.load(std::memory_order_acquire); left != 0;
+         left = work->groups_left.load(std::memory_order_acquire)) {
+        work->groups_left.wait(left, std::memory_order_acquire);
+    }
+    if (work->groups.size() > 1) {
+        std::scoped_lock lock{work_mutex};
+        current_work.reset();
+    }
+
+    for (AjmJob* job : statistics_jobs) {
+        AjmInstanceStatistics::Getinstance().ExecuteJob(*job);
     }
 }
 
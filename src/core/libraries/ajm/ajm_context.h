@@ -11,11 +11,15 @@
 #include "core/libraries/ajm/ajm_instance.h"
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <span>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace Libraries::Ajm {
 
@@ -40,8 +44,26 @@ private:
     static constexpr u32 MaxBatches = 0x0400;
     static constexpr u32 NumAjmCodecs = std::to_underlying(AjmCodecType::Max);
 
+    /// The jobs of a batch that target one instance, in submission order.
+    struct JobGroup {
+        u32 instance_index;
+        AjmCodecType codec_type;
+        std::shared_ptr<AjmInstance> instance;
+        std::vector<AjmJob*> jobs;
+    };
+
+    /// The instance groups of the batch being processed, claimed by decoders one at a time.
+    struct BatchWork {
+        std::vector<JobGroup> groups;
+        std::atomic<size_t> next_group{};
+        std::atomic<size_t> groups_left{};
+    };
+
     [[nodiscard]] bool IsRegistered(AjmCodecType type) const;
 
+    void DecoderThread(std::stop_token stop, u32 index);
+    void RunJobGroups(BatchWork& work);
+
     std::array<bool, NumAjmCodecs> registered_codecs{};
 
     std::shared_mutex instances_mutex;
@@ -50,8 +72,14 @@ private:
     std::shared_mutex batches_mutex;
     Common::SlotArray<u32, std::shared_ptr<AjmBatch>, MaxBatches, 1> batches;
 
-    std::jthread worker_thread{};
+    std::mutex work_mutex;
+    std::condition_variable_any work_cv;
+    std::shared_ptr<BatchWork> current_work;
+    u64 work_generation{};
+    std::vector<std::jthread> decoder_threads;
+
     Common::MPSCQueue<std::shared_ptr<AjmBatch>> batch_queue;
+    std::jthread worker_thread{};
 };
 
 } // namespace Libraries::Ajm
@@ -1,23 +1,61 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <utility>
+
 #include "core/libraries/ajm/ajm.h"
 #include "core/libraries/ajm/ajm_instance_statistics.h"
 
 namespace Libraries::Ajm {
 
+static s64 NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+AjmInstanceStatistics::AjmInstanceStatistics() {
+    Reset();
+}
+
 void AjmInstanceStatistics::ExecuteJob(AjmJob& job) {
+    // Usage is reported over the time since the previous statistics job.
+    const s64 now = NowNs();
+    const s64 window_ns = std::max<s64>(now - window_start_ns.exchange(now), 1);
+    const double capacity_ns = static_cast<double>(window_ns) * num_decoders;
+    std::array<u64, NumCodecs> codec_ns;
+    for (size_t i = 0; i < NumCodecs; ++i) {
+        codec_ns[i] = decode_ns[i].exchange(0, std::memory_order_relaxed);
+    }
+    const u64 total_ns = std::accumulate(codec_ns.begin(), codec_ns.end(), u64{0});
+    const float usage = static_cast<float>(std::min(total_ns / capacity_ns, 1.0));
+
     if (job.output.p_engine) {
-        job.output.p_engine->usage_batch = 0.05;
-        const auto ic = job.input.statistics_engine_parameters->interval_count;
+        job.output.p_engine->usage_batch = usage;
+        const auto& parameters = job.input.statistics_engine_parameters;
+        const u32 ic = parameters ? std::min(parameters->interval_count, 3U) : 0;
         for (u32 idx = 0; idx < ic; ++idx) {
-            job.output.p_engine->usage_interval[idx] = 0.01;
+            job.output.p_engine->usage_interval[idx] = usage;
         }
     }
     if (job.output.p_engine_per_codec) {
-        job.output.p_engine_per_codec->codec_count = 1;
-        job.output.p_engine_per_codec->codec_id[0] = static_cast<u8>(AjmCodecType::At9Dec);
-        job.output.p_engine_per_codec->codec_percentage[0] = 0.01;
+        // Busiest codecs first.
+        std::array<u8, NumCodecs> codecs{0, 1, 2};
+        std::ranges::sort(codecs, std::greater{}, [&](u8 codec) { return codec_ns[codec]; });
+        auto& per_codec = *job.output.p_engine_per_codec;
+        per_codec.codec_count = 0;
+        for (const u8 codec : codecs) {
+            if (codec_ns[codec] == 0) {
+                break;
+            }
+            per_codec.codec_id[per_codec.codec_count] = codec;
+            per_codec.codec_percentage[per_codec.codec_count] =
+                static_cast<float>(std::min(codec_ns[codec] / capacity_ns, 1.0));
+            ++per_codec.codec_count;
+        }
     }
     if (job.output.p_memory) {
         job.output.p_memory->instance_free = 0x400000;
@@ -29,7 +67,23 @@ void AjmInstanceStatistics::ExecuteJob(AjmJob& job) {
     }
 }
 
-void AjmInstanceStatistics::Reset() {}
+void AjmInstanceStatistics::Reset() {
+    for (auto& ns : decode_ns) {
+        ns.store(0, std::memory_order_relaxed);
+    }
+    window_start_ns = NowNs();
+}
+
+void AjmInstanceStatistics::SetNumDecoders(u32 num_decoders_) {
+    num_decoders = std::max(num_decoders_, 1U);
+}
+
+void AjmInstanceStatistics::RecordDecode(AjmCodecType codec_type, std::chrono::nanoseconds time) {
+    const auto codec = std::to_underlying(codec_type);
+    if (codec < NumCodecs) {
+        decode_ns[codec].fetch_add(time.count(), std::memory_order_relaxed);
+    }
+}
 
 AjmInstanceStatistics& AjmInstanceStatistics::Getinstance() {
     static AjmInstanceStatistics instance;
@@ -3,16 +3,35 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+
 #include "core/libraries/ajm/ajm_batch.h"
 
 namespace Libraries::Ajm {
 
 class AjmInstanceStatistics {
 public:
+    AjmInstanceStatistics();
+
     void ExecuteJob(AjmJob& job);
     void Reset();
 
+    /// Sets how many threads decode concurrently, which is the capacity usage is measured against.
+    void SetNumDecoders(u32 num_decoders);
+
+    /// Accounts time spent decoding a job of the given codec.
+    void RecordDecode(AjmCodecType codec_type, std::chrono::nanoseconds time);
+
     static AjmInstanceStatistics& Getinstance();
+
+private:
+    static constexpr size_t NumCodecs = 3;
+
+    std::array<std::atomic<u64>, NumCodecs> decode_ns{};
+    std::atomic<s64> window_start_ns{};
+    u32 num_decoders{1};
 };
 
 } // namespace Libraries::Ajm
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "core/libraries/audio/audio_convert.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define HAS_NEON
+#endif
+
+namespace Libraries::AudioOut {
+
+constexpr float INV_S16_SCALE = 1.0f / 32768.0f;
+
+// The x86 build targets x86-64-v3, so AVX2 is always available there. Both vector paths handle a
+// group of 8 samples per step, matching the period of the gain pattern, and leave the remainder
+// to the scalar loops.
+
+void ConvertS16Samples(const s16* src, float* dst, u32 num_samples, const SampleGains& gains) {
+    SampleGains scale;
+    for (u32 i = 0; i < scale.size(); i++) {
+        scale[i] = gains[i] * INV_S16_SCALE;
+    }
+    u32 i = 0;
+#if defined(__AVX2__)
+    const __m256 vscale = _mm256_loadu_ps(scale.data());
+    for (; i + 16 <= num_samples; i += 16) {
+        const __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+        const __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i + 8]));
+        const __m256 f0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(s0));
+        const __m256 f1 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(s1));
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(f0, vscale));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(f1, vscale));
+    }
+    for (; i + 8 <= num_samples; i += 8) {
+        const __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&src[i]));
+        const __m256 f0 = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(s0));
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(f0, vscale));
+    }
+#elif defined(HAS_NEON)
+    const float32x4_t scale_lo = vld1q_f32(&scale[0]);
+    const float32x4_t scale_hi = vld1q_f32(&scale[4]);
+    for (; i + 8 <= num_samples; i += 8) {
+        const int16x8_t s = vld1q_s16(&src[i]);
+        const float32x4_t lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+        const float32x4_t hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+        vst1q_f32(&dst[i], vmulq_f32(lo, scale_lo));
+        vst1q_f32(&dst[i + 4], vmulq_f32(hi, scale_hi));
+    }
+#endif
+    for (; i < num_samples; i++) {
+        dst[i] = src[i] * scale[i & 7];
+    }
+}
+
+void ScaleF32Samples(const float* src, float* dst, u32 num_samples, const SampleGains& gains) {
+    u32 i = 0;
+#if defined(__AVX2__)
+    const __m256 vgains = _mm256_loadu_ps(gains.data());
+    for (; i + 16 <= num_samples; i += 16) {
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgains));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgains));
+    }
+    for (; i + 8 <= num_samples; i += 8) {
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgains));
+    }
+#elif defined(HAS_NEON)
+    const float32x4_t gains_lo = vld1q_f32(&gains[0]);
+    const float32x4_t gains_hi = vld1q_f32(&gains[4]);
+    for (; i + 8 <= num_samples; i += 8) {
+        vst1q_f32(&dst[i], vmulq_f32(vld1q_f32(&src[i]), gains_lo));
+        vst1q_f32(&dst[i + 4], vmulq_f32(vld1q_f32(&src[i + 4]), gains_hi));
+    }
+#endif
+    for (; i < num_samples; i++) {
+        dst[i] = src[i] * gains[i & 7];
+    }
+}
+
+void RemapStd8CHSamples(const float* src, float* dst, u32 num_frames, const SampleGains& gains) {
+    // Host order is FL FR FC LFE SL SR BL BR, the standard layout stores BL BR before SL SR.
+    static constexpr std::array<u32, 8> SourceChannel = {0, 1, 2, 3, 6, 7, 4, 5};
+    u32 frame = 0;
+#if defined(__AVX2__)
+    const __m256 vgains = _mm256_loadu_ps(gains.data());
+    const __m256i order = _mm256_setr_epi32(0, 1, 2, 3, 6, 7, 4, 5);
+    for (; frame < num_frames; frame++) {
+        const __m256 s = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&src[frame * 8]), order);
+        _mm256_storeu_ps(&dst[frame * 8], _mm256_mul_ps(s, vgains));
+    }
+#elif defined(HAS_NEON)
+    const float32x4_t gains_lo = vld1q_f32(&gains[0]);
+    const float32x4_t gains_hi = vld1q_f32(&gains[4]);
+    for (; frame < num_frames; frame++) {
+        const float32x4_t lo = vld1q_f32(&src[frame * 8]);
+        const float32x4_t hi = vld1q_f32(&src[frame * 8 + 4]);
+        vst1q_f32(&dst[frame * 8], vmulq_f32(lo, gains_lo));
+        vst1q_f32(&dst[frame * 8 + 4], vmulq_f32(vextq_f32(hi, hi, 2), gains_hi));
+    }
+#endif
+    for (; frame < num_frames; frame++) {
+        for (u32 ch = 0; ch < 8; ch++) {
+            dst[frame * 8 + ch] = src[frame * 8 + SourceChannel[ch]] * gains[ch];
+        }
+    }
+}
+
+} // namespace Libraries::AudioOut
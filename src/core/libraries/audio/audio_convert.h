@@ -0,0 +1,30 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+
+#include "common/types.h"
+
+namespace Libraries::AudioOut {
+
+/**
+ * Gains of 8 consecutive samples of an interleaved buffer. Every supported channel count divides
+ * 8, so the same pattern applies to each group of 8 samples.
+ */
+using SampleGains = std::array<float, 8>;
+
+/// Converts signed 16-bit samples to float in the [-1, 1] range and applies the gains.
+void ConvertS16Samples(const s16* src, float* dst, u32 num_samples, const SampleGains& gains);
+
+/// Applies the gains to float samples.
+void ScaleF32Samples(const float* src, float* dst, u32 num_samples, const SampleGains& gains);
+
+/**
+ * Reorders float frames of the standard 8 channel layout, which has the side and back pairs
+ * swapped, to the host order and applies the gains in host channel order.
+ */
+void RemapStd8CHSamples(const float* src, float* dst, u32 num_frames, const SampleGains& gains);
+
+} // namespace Libraries::AudioOut
@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string_view>
+#include <vector>
+#include <fmt/format.h>
+
+#include "core/libraries/audio/audio_convert.h"
+#include "core/libraries/audio/audio_convert_bench.h"
+
+namespace Libraries::AudioOut {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Each measurement repeats the conversion until this much time has passed.
+constexpr auto MinRunTime = std::chrono::milliseconds{200};
+
+// The scalar loops the kernels replaced, kept out of line so they are timed as written.
+
+[[gnu::noinline]] void ScalarS16(const s16* src, float* dst, u32 num_samples,
+                                 const SampleGains& gains) {
+    for (u32 i = 0; i < num_samples; i++) {
+        dst[i] = src[i] * (gains[i & 7] * (1.0f / 32768.0f));
+    }
+}
+
+[[gnu::noinline]] void ScalarF32(const float* src, float* dst, u32 num_samples,
+                                 const SampleGains& gains) {
+    for (u32 i = 0; i < num_samples; i++) {
+        dst[i] = src[i] * gains[i & 7];
+    }
+}
+
+[[gnu::noinline]] void ScalarStd8CH(const float* src, float* dst, u32 num_frames,
+                                    const SampleGains& gains) {
+    static constexpr std::array<u32, 8> SourceChannel = {0, 1, 2, 3, 6, 7, 4, 5};
+    for (u32 frame = 0; frame < num_frames; frame++) {
+        for (u32 ch = 0; ch < 8; ch++) {
+            dst[frame * 8 + ch] = src[frame * 8 + SourceChannel[ch]] * gains[ch];
+        }
+    }
+}
+
+/// Returns the average time of one call in nanoseconds.
+double Measure(const std::function<void()>& func) {
+    u64 num_runs = 0;
+    const auto start = Clock::now();
+    auto end = start;
+    do {
+        func();
+        ++num_runs;
+        end = Clock::now();
+    } while (end - start < MinRunTime);
+    return std::chrono::duration<double, std::nano>(end - start).count() / num_runs;
+}
+
+struct Case {
+    std::string_view name;
+    u32 num_channels;
+    bool is_s16;
+    bool is_std8ch;
+};
+
+} // Anonymous namespace
+
+int BenchmarkAudioConvert(u32 num_frames) {
+    static constexpr std::array<Case, 6> Cases = {{
+        {"S16 mono", 1, true, false},
+        {"S16 stereo", 2, true, false},
+        {"S16 8CH", 8, true, false},
+        {"F32 mono", 1, false, false},
+        {"F32 stereo", 2, false, false},
+        {"F32 8CH std", 8, false, true},
+    }};
+
+    std::mt19937 rng{0x5eed};
+    std::uniform_int_distribution<int> s16_dist{-32768, 32767};
+    std::uniform_real_distribution<float> f32_dist{-1.0f, 1.0f};
+    std::uniform_real_distribution<float> gain_dist{0.0f, 1.0f};
+
+    SampleGains gains;
+    for (auto& gain : gains) {
+        gain = gain_dist(rng);
+    }
+
+    const u32 max_samples = num_frames * 8;
+    std::vector<s16> s16_src(max_samples);
+    std::vector<float> f32_src(max_samples);
+    for (u32 i = 0; i < max_samples; i++) {
+        s16_src[i] = static_cast<s16>(s16_dist(rng));
+        f32_src[i] = f32_dist(rng);
+    }
+    std::vector<float> expected(max_samples);
+    std::vector<float> actual(max_samples);
+
+    fmt::print("Converting buffers of {} frames\n", num_frames);
+    fmt::print("\n{:<16} {:>14} {:>14} {:>10} {:>12}\n", "Layout", "Scalar (ns)", "Kernel (ns)",
+               "Speedup", "Max error");
+
+    bool all_match = true;
+    for (const auto& test : Cases) {
+        const u32 num_samples = num_frames * test.num_channels;
+        std::function<void(float*)> scalar;
+        std::function<void(float*)> kernel;
+        if (test.is_s16) {
+            scalar = [&](float* dst) { ScalarS16(s16_src.data(), dst, num_samples, gains); };
+            kernel = [&](float* dst) {
+                ConvertS16Samples(s16_src.data(), dst, num_samples, gains);
+            };
+        } else if (test.is_std8ch) {
+            scalar = [&](float* dst) { ScalarStd8CH(f32_src.data(), dst, num_frames, gains); };
+            kernel = [&](float* dst) {
+                RemapStd8CHSamples(f32_src.data(), dst, num_frames, gains);
+            };
+        } else {
+            scalar = [&](float* dst) { ScalarF32(f32_src.data(), dst, num_samples, gains); };
+            kernel = [&](float* dst) { ScaleF32Samples(f32_src.data(), dst, num_samples, gains); };
+        }
+
+        scalar(expected.data());
+        kernel(actual.data());
+        float max_error = 0.0f;
+        for (u32 i = 0; i < num_samples; i++) {
+            max_error = std::max(max_error, std::abs(expected[i] - actual[i]));
+        }
+        // Both sides multiply the same two floats, the results have to be identical.
+        const bool match = max_error == 0.0f;
+        all_match &= match;
+
+        const double scalar_ns = Measure([&] { scalar(expected.data()); });
+        const double kernel_ns = Measure([&] { kernel(actual.data()); });
+        fmt::print("{:<16} {:>14.1f} {:>14.1f} {:>9.2f}x {:>12}\n", test.name, scalar_ns,
+                   kernel_ns, scalar_ns / kernel_ns,
+                   match ? "0" : fmt::format("{:.3g} FAIL", max_error));
+    }
+    return all_match ? 0 : 1;
+}
+
+} // namespace Libraries::AudioOut
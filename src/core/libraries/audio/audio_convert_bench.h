@@ -0,0 +1,18 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "common/types.h"
+
+namespace Libraries::AudioOut {
+
+/**
+ * Times the audio output conversion kernels against plain scalar loops for every port layout and
+ * checks that both produce the same samples. Does not need a running game or an audio device.
+ * @param num_frames  Frames per converted buffer, i.e. the port period size.
+ * @returns Process exit code, non-zero if a kernel disagrees with its scalar loop.
+ */
+int BenchmarkAudioConvert(u32 num_frames);
+
+} // namespace Libraries::AudioOut
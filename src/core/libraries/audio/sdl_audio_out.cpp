@@ -11,16 +11,11 @@
 
 #include "common/config.h"
 #include "common/logging/log.h"
+#include "core/libraries/audio/audio_convert.h"
 #include "core/libraries/audio/audioout.h"
 #include "core/libraries/audio/audioout_backend.h"
 #include "core/libraries/kernel/threads.h"
 
-// SIMD support detection
-#if defined(__x86_64__) || defined(_M_X64)
-#include <immintrin.h>
-#define HAS_SSE2
-#endif
-
 #define SDL_INVALID_AUDIODEVICEID 0
 
 namespace Libraries::AudioOut {
@@ -83,7 +78,7 @@ public:
 
         UpdateVolumeIfChanged();
         const u64 current_time = Kernel::sceKernelGetProcessTime();
-        convert(ptr, internal_buffer, buffer_frames, nullptr);
+        convert(ptr, internal_buffer, buffer_frames, sample_gains);
         HandleTiming(current_time);
 
         if ((output_count++ & 0xF) == 0) { // Check every 16 outputs
@@ -102,28 +97,22 @@ public:
             return;
         }
 
-        float max_channel_gain = 0.0f;
-        const u32 channels_to_check = std::min(num_channels, 8u);
-
-        for (u32 i = 0; i < channels_to_check; i++) {
-            const float channel_gain = static_cast<float>(ch_volumes[i]) * INV_VOLUME_0DB;
-            max_channel_gain = std::max(max_channel_gain, channel_gain);
+        // Channel volumes are applied by the converter, the stream gain follows the slider.
+        for (u32 i = 0; i < sample_gains.size(); i++) {
+            sample_gains[i] = static_cast<float>(ch_volumes[i % num_channels]) * INV_VOLUME_0DB;
         }
 
         const float slider_gain = Config::getVolumeSlider() * 0.01f; // Faster than /100.0f
-        const float total_gain = max_channel_gain * slider_gain;
 
         const float current = current_gain.load(std::memory_order_acquire);
-        if (std::abs(total_gain - current) < VOLUME_EPSILON) {
+        if (std::abs(slider_gain - current) < VOLUME_EPSILON) {
             return;
         }
 
         // Apply volume change
-        if (SDL_SetAudioStreamGain(stream, total_gain)) {
-            current_gain.store(total_gain, std::memory_order_release);
-            LOG_DEBUG(Lib_AudioOut,
-                      "Set combined audio gain to {:.3f} (channel: {:.3f}, slider: {:.3f})",
-                      total_gain, max_channel_gain, slider_gain);
+        if (SDL_SetAudioStreamGain(stream, slider_gain)) {
+            current_gain.store(slider_gain, std::memory_order_release);
+            LOG_DEBUG(Lib_AudioOut, "Set audio gain to {:.3f}", slider_gain);
         } else {
             LOG_ERROR(Lib_AudioOut, "Failed to set audio stream gain: {}", SDL_GetError());
         }
@@ -380,13 +369,13 @@ private:
         if (is_float) {
             switch (num_channels) {
             case 1:
-                convert = &ConvertF32Mono;
+                convert = &ConvertF32<1>;
                 break;
             case 2:
-                convert = &ConvertF32Stereo;
+                convert = &ConvertF32<2>;
                 break;
             case 8:
-                convert = is_std ? &ConvertF32Std8CH : &ConvertF32_8CH;
+                convert = is_std ? &ConvertF32Std8CH : &ConvertF32<8>;
                 break;
             default:
                 LOG_ERROR(Lib_AudioOut, "Unsupported float channel count: {}", num_channels);
@@ -395,21 +384,13 @@ private:
         } else {
             switch (num_channels) {
             case 1:
-                convert = &ConvertS16Mono;
+                convert = &ConvertS16<1>;
                 break;
             case 2:
-#if defined(HAS_SSE2)
-                convert = &ConvertS16StereoSIMD;
-#else
-                convert = &ConvertS16Stereo;
-#endif
+                convert = &ConvertS16<2>;
                 break;
             case 8:
-#if defined(HAS_SSE2)
-                convert = &ConvertS16_8CH_SIMD;
-#else
-                convert = &ConvertS16_8CH;
-#endif
+                convert = &ConvertS16<8>;
                 break;
             default:
                 LOG_ERROR(Lib_AudioOut, "Unsupported S16 channel count: {}", num_channels);
@@ -440,126 +421,24 @@ private:
                   queue_threshold, sdl_buffer_frames);
     }
 
-    using ConverterFunc = void (*)(const void* src, void* dst, u32 frames, const float* volumes);
-
-    static void ConvertS16Mono(const void* src, void* dst, u32 frames, const float*) {
-        const s16* s = static_cast<const s16*>(src);
-        float* d = static_cast<float*>(dst);
-
-        for (u32 i = 0; i < frames; i++) {
-            d[i] = s[i] * INV_VOLUME_0DB;
-        }
-    }
-
-    static void ConvertS16Stereo(const void* src, void* dst, u32 frames, const float*) {
-        const s16* s = static_cast<const s16*>(src);
-        float* d = static_cast<float*>(dst);
+    using ConverterFunc = void (*)(const void* src, void* dst, u32 frames,
+                                   const SampleGains& gains);
 
-        const u32 num_samples = frames << 1; // * 2
-        for (u32 i = 0; i < num_samples; i++) {
-            d[i] = s[i] * INV_VOLUME_0DB;
-        }
+    template <u32 NumChannels>
+    static void ConvertS16(const void* src, void* dst, u32 frames, const SampleGains& gains) {
+        ConvertS16Samples(static_cast<const s16*>(src), static_cast<float*>(dst),
+                          frames * NumChannels, gains);
     }
 
-#ifdef HAS_SSE2
-    static void ConvertS16StereoSIMD(const void* src, void* dst, u32 frames, const float*) {
-        const s16* s = static_cast<const s16*>(src);
-        float* d = static_cast<float*>(dst);
-
-        const __m128 scale = _mm_set1_ps(INV_VOLUME_0DB);
-        const u32 num_samples = frames << 1;
-        u32 i = 0;
-
-        // Process 8 samples at a time (4 stereo frames)
-        for (; i + 8 <= num_samples; i += 8) {
-            // Load 8 s16 values
-            __m128i s16_vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s[i]));
-
-            // Convert to 32-bit integers
-            __m128i s32_lo = _mm_cvtepi16_epi32(s16_vals);
-            __m128i s32_hi = _mm_cvtepi16_epi32(_mm_srli_si128(s16_vals, 8));
-
-            // Convert to float and scale
-            __m128 f_lo = _mm_mul_ps(_mm_cvtepi32_ps(s32_lo), scale);
-            __m128 f_hi = _mm_mul_ps(_mm_cvtepi32_ps(s32_hi), scale);
-
-            // Store results
-            _mm_storeu_ps(&d[i], f_lo);
-            _mm_storeu_ps(&d[i + 4], f_hi);
-        }
-
-        // Handle remaining samples
-        for (; i < num_samples; i++) {
-            d[i] = s[i] * INV_VOLUME_0DB;
-        }
+    template <u32 NumChannels>
+    static void ConvertF32(const void* src, void* dst, u32 frames, const SampleGains& gains) {
+        ScaleF32Samples(static_cast<const float*>(src), static_cast<float*>(dst),
+                        frames * NumChannels, gains);
     }
-#endif
 
-    static void ConvertS16_8CH(const void* src, void* dst, u32 frames, const float*) {
-        const s16* s = static_cast<const s16*>(src);
-        float* d = static_cast<float*>(dst);
-
-        const u32 num_samples = frames << 3; // * 8
-        for (u32 i = 0; i < num_samples; i++) {
-            d[i] = s[i] * INV_VOLUME_0DB;
-        }
-    }
-
-#ifdef HAS_SSE2
-    static void ConvertS16_8CH_SIMD(const void* src, void* dst, u32 frames, const float*) {
-        const s16* s = static_cast<const s16*>(src);
-        float* d = static_cast<float*>(dst);
-
-        const __m128 scale = _mm_set1_ps(INV_VOLUME_0DB);
-        const u32 num_samples = frames << 3;
-        u32 i = 0;
-
-        // Process 8 samples at a time
-        for (; i + 8 <= num_samples; i += 8) {
-            __m128i s16_vals = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&s[i]));
-            __m128i s32_lo = _mm_cvtepi16_epi32(s16_vals);
-            __m128i s32_hi = _mm_cvtepi16_epi32(_mm_srli_si128(s16_vals, 8));
-            __m128 f_lo = _mm_mul_ps(_mm_cvtepi32_ps(s32_lo), scale);
-            __m128 f_hi = _mm_mul_ps(_mm_cvtepi32_ps(s32_hi), scale);
-            _mm_storeu_ps(&d[i], f_lo);
-            _mm_storeu_ps(&d[i + 4], f_hi);
-        }
-
-        for (; i < num_samples; i++) {
-            d[i] = s[i] * INV_VOLUME_0DB;
-        }
-    }
-#endif
-
-    static void ConvertF32Mono(const void* src, void* dst, u32 frames, const float*) {
-        std::memcpy(dst, src, frames * sizeof(float));
-    }
-
-    static void ConvertF32Stereo(const void* src, void* dst, u32 frames, const float*) {
-        std::memcpy(dst, src, frames * 2 * sizeof(float));
-    }
-
-    static void ConvertF32_8CH(const void* src, void* dst, u32 frames, const float*) {
-        std::memcpy(dst, src, frames * 8 * sizeof(float));
-    }
-
-    static void ConvertF32Std8CH(const void* src, void* dst, u32 frames, const float*) {
-        const float* s = static_cast<const float*>(src);
-        float* d = static_cast<float*>(dst);
-
-        // Channel remapping for standard 8CH layout
-        for (u32 i = 0; i < frames; i++) {
-            const u32 offset = i << 3; // * 8
-
-            d[offset + FL] = s[offset + FL];
-            d[offset + FR] = s[offset + FR];
-            d[offset + FC] = s[offset + FC];
-            d[offset + LF] = s[offset + LF];
-            d[offset + SL] = s[offset + STD_SL];
-            d[offset + SR] = s[offset + STD_SR];
-            d[offset + BL] = s[offset + STD_BL];
-            d[offset + BR] = s[offset + STD_BR];
-        }
+    static void ConvertF32Std8CH(const void* src, void* dst, u32 frames,
+                                 const SampleGains& gains) {
+        RemapStd8CHSamples(static_cast<const float*>(src), static_cast<float*>(dst), frames, gains);
     }
 
     // Audio format parameters
@@ -582,8 +461,9 @@ private:
     u32 internal_buffer_size{0};
     void* internal_buffer{nullptr};
 
-    // Converter function pointer
+    // Converter function pointer and the channel volumes it applies
     ConverterFunc convert{nullptr};
+    SampleGains sample_gains{1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
 
     // Volume management
     alignas(64) std::atomic<float> current_gain{1.0f};
@@ -1,14 +1,24 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <thread>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <vector>
 
 #include "aio.h"
 #include "common/assert.h"
 #include "common/debug.h"
 #include "common/logging/log.h"
+#include "common/thread.h"
 #include "core/libraries/kernel/equeue.h"
 #include "core/libraries/kernel/orbis_error.h"
+#include "core/libraries/kernel/threads.h"
 #include "core/libraries/libs.h"
 #include "file_system.h"
 
@@ -16,8 +26,274 @@ namespace Libraries::Kernel {
 
 #define MAX_QUEUE 512
 
-static s32* id_state;
-static s32 id_index;
+constexpr u32 NumAioThreads = 4;
+constexpr u32 NumPriorities = ORBIS_KERNEL_AIO_PRIORITY_HIGH;
+
+// Limits of a coalesced read, and how far down the queue a worker looks for adjacent reads.
+constexpr size_t MaxCoalescedCommands = 64;
+constexpr u64 MaxCoalescedBytes = 4_MB;
+constexpr size_t CoalesceWindow = 32;
+
+struct AioRequest {
+    // The id can be reused once the state is no longer submitted or processing.
+    std::atomic<u32> state;
+    std::atomic<u32> remaining;
+    std::atomic_bool failed;
+    // Ids of the Multiple variants take the state of their only command.
+    bool mirror_result;
+};
+
+struct AioCommand {
+    // Copied, as the request array only has to live until the submit call returns.
+    OrbisKernelAioRWRequest req;
+    OrbisKernelAioSubmitId id;
+    bool write;
+};
+
+static std::array<AioRequest, MAX_QUEUE> requests;
+static s32 id_index = 1;
+
+static std::array<Thread, NumAioThreads> aio_threads;
+static std::once_flag aio_threads_started;
+static std::mutex queue_mutex;
+static std::condition_variable_any queue_cv;
+static std::array<std::deque<AioCommand>, NumPriorities> queues;
+
+static std::mutex wait_mutex;
+static std::condition_variable_any wait_cv;
+
+static AioRequest* GetRequest(OrbisKernelAioSubmitId id) {
+    if (id <= 0 || id >= MAX_QUEUE) {
+        return nullptr;
+    }
+    return &requests[id];
+}
+
+static bool IsPending(u32 state) {
+    return state == ORBIS_KERNEL_AIO_STATE_SUBMITTED ||
+           state == ORBIS_KERNEL_AIO_STATE_PROCESSING;
+}
+
+static bool IsPending(OrbisKernelAioSubmitId id) {
+    const auto* request = GetRequest(id);
+    return request && IsPending(request->state.load(std::memory_order_acquire));
+}
+
+static void NotifyWaiters() {
+    // Taking the lock orders the state change before a waiter that is about to sleep.
+    { std::scoped_lock lock{wait_mutex}; }
+    wait_cv.notify_all();
+}
+
+static u32 CancelRequest(OrbisKernelAioSubmitId id) {
+    auto& request = requests[id];
+    {
+        // Only requests no worker has taken a command of can be cancelled. Their commands are
+        // dropped right away, so nothing touches the buffers or results after this returns.
+        std::scoped_lock lock{queue_mutex};
+        const u32 state = request.state.load(std::memory_order_relaxed);
+        if (state != ORBIS_KERNEL_AIO_STATE_SUBMITTED) {
+            return state;
+        }
+        for (auto& queue : queues) {
+            std::erase_if(queue, [id](const AioCommand& command) {
+                if (command.id != id) {
+                    return false;
+                }
+                command.req.result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
+                return true;
+            });
+        }
+        request.state.store(ORBIS_KERNEL_AIO_STATE_ABORTED, std::memory_order_release);
+    }
+    NotifyWaiters();
+    return ORBIS_KERNEL_AIO_STATE_ABORTED;
+}
+
+static void FinishCommand(const AioCommand& command, bool failed) {
+    auto& request = requests[command.id];
+    if (failed) {
+        request.failed.store(true, std::memory_order_relaxed);
+    }
+    if (request.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+    const bool aborted = request.mirror_result && request.failed.load(std::memory_order_relaxed);
+    request.state.store(aborted ? ORBIS_KERNEL_AIO_STATE_ABORTED : ORBIS_KERNEL_AIO_STATE_COMPLETED,
+                        std::memory_order_release);
+    NotifyWaiters();
+}
+
+static void TakeCommand(std::vector<AioCommand>& batch, const AioCommand& command) {
+    // From here on the request can no longer be cancelled.
+    requests[command.id].state.store(ORBIS_KERNEL_AIO_STATE_PROCESSING, std::memory_order_release);
+    batch.push_back(command);
+}
+
+/// Moves the next command of the highest priority into batch, along with queued reads that
+/// continue it in the same file.
+static void TakeCommands(std::vector<AioCommand>& batch) {
+    auto& queue = *std::find_if(queues.rbegin(), queues.rend(),
+                                [](const auto& queue) { return !queue.empty(); });
+    TakeCommand(batch, queue.front());
+    queue.pop_front();
+    if (batch[0].write) {
+        return;
+    }
+
+    u64 size = batch[0].req.nbyte;
+    for (size_t i = 0; i < std::min(queue.size(), CoalesceWindow);) {
+        const auto& next = queue[i];
+        const auto& last = batch.back().req;
+        if (batch.size() == MaxCoalescedCommands) {
+            break;
+        }
+        if (!next.write && next.req.fd == last.fd && next.req.offset == last.offset + last.nbyte &&
+            size + next.req.nbyte <= MaxCoalescedBytes) {
+            size += next.req.nbyte;
+            TakeCommand(batch, next);
+            queue.erase(queue.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+/// Performs commands that cover one contiguous file range with a single call.
+static void ExecuteCommands(std::span<const AioCommand> commands,
+                            std::vector<OrbisKernelIovec>& iovecs) {
+    for (const auto& command : commands) {
+        command.req.result->state = ORBIS_KERNEL_AIO_STATE_PROCESSING;
+    }
+
+    const auto& first = commands.front();
+    s64 ret;
+    if (first.write) {
+        ret = sceKernelPwrite(first.req.fd, first.req.buf, first.req.nbyte, first.req.offset);
+    } else {
+        iovecs.clear();
+        for (const auto& command : commands) {
+            iovecs.push_back({command.req.buf, static_cast<size_t>(command.req.nbyte)});
+        }
+        ret = sceKernelPreadv(first.req.fd, iovecs.data(), static_cast<s32>(iovecs.size()),
+                              first.req.offset);
+    }
+
+    // Hand each command its share of the transferred bytes, like separate calls would have.
+    s64 left = ret;
+    for (const auto& command : commands) {
+        auto* result = command.req.result;
+        if (ret < 0) {
+            result->returnValue = ret;
+            result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
+        } else {
+            result->returnValue = std::min(left, command.req.nbyte);
+            result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
+            left -= result->returnValue;
+        }
+        FinishCommand(command, ret < 0);
+    }
+}
+
+static void AioThread(const std::stop_token& stop, u32 index) {
+    Common::SetCurrentThreadName(fmt::format("shadPS4:AioThread{}", index).c_str());
+
+    std::vector<AioCommand> batch;
+    std::vector<OrbisKernelIovec> iovecs;
+    while (true) {
+        batch.clear();
+        {
+            std::unique_lock lock{queue_mutex};
+            const auto has_commands = [] {
+                return std::ranges::any_of(queues,
+                                           [](const auto& queue) { return !queue.empty(); });
+            };
+            if (!queue_cv.wait(lock, stop, has_commands)) {
+                return;
+            }
+            TakeCommands(batch);
+        }
+        ExecuteCommands(batch, iovecs);
+    }
+}
+
+static s32 AllocateId() {
+    // Skips ids whose commands are still in flight.
+    for (s32 i = 1; i < MAX_QUEUE; i++) {
+        const s32 id = id_index;
+        // skip id_index equals 0, because sceKernelAioCancelRequest will submit id equal to 0
+        id_index = id_index % (MAX_QUEUE - 1) + 1;
+        if (!IsPending(requests[id].state.load(std::memory_order_acquire))) {
+            return id;
+        }
+    }
+    return -1;
+}
+
+static s32 SubmitCommands(OrbisKernelAioRWRequest req[], s32 size, s32 prio,
+                          OrbisKernelAioSubmitId id[], bool write, bool multiple) {
+    if (req == nullptr) {
+        return ORBIS_KERNEL_ERROR_EFAULT;
+    }
+    if (id == nullptr) {
+        return ORBIS_KERNEL_ERROR_EFAULT;
+    }
+    if (size <= 0) {
+        return ORBIS_KERNEL_ERROR_EINVAL;
+    }
+    std::call_once(aio_threads_started, [] {
+        for (u32 i = 0; i < NumAioThreads; i++) {
+            aio_threads[i].Run([i](const std::stop_token& stop) { AioThread(stop, i); });
+        }
+    });
+
+    const u32 priority = std::clamp<s32>(prio, ORBIS_KERNEL_AIO_PRIORITY_LOW,
+                                         ORBIS_KERNEL_AIO_PRIORITY_HIGH);
+    auto& queue = queues[priority - 1];
+    {
+        std::scoped_lock lock{queue_mutex};
+        const s32 num_ids = multiple ? size : 1;
+        std::vector<u32> previous_states(num_ids);
+        for (s32 i = 0; i < num_ids; i++) {
+            const s32 new_id = AllocateId();
+            if (new_id < 0) {
+                // Nothing has been queued yet, give back the ids taken so far.
+                for (s32 j = 0; j < i; j++) {
+                    requests[id[j]].state.store(previous_states[j], std::memory_order_relaxed);
+                }
+                return ORBIS_KERNEL_ERROR_EAGAIN;
+            }
+            auto& request = requests[new_id];
+            previous_states[i] = request.state.load(std::memory_order_relaxed);
+            request.remaining.store(multiple ? 1 : size, std::memory_order_relaxed);
+            request.failed.store(false, std::memory_order_relaxed);
+            request.mirror_result = multiple;
+            request.state.store(ORBIS_KERNEL_AIO_STATE_SUBMITTED, std::memory_order_release);
+            id[i] = new_id;
+        }
+        for (s32 i = 0; i < size; i++) {
+            req[i].result->state = ORBIS_KERNEL_AIO_STATE_SUBMITTED;
+            queue.push_back(AioCommand{
+                .req = req[i],
+                .id = id[multiple ? i : 0],
+                .write = write,
+            });
+        }
+    }
+    queue_cv.notify_all();
+    return 0;
+}
+
+template <typename Pred>
+static bool WaitForRequests(Pred&& pred, const u32* usec) {
+    // A null or zero timeout waits for as long as it takes.
+    std::unique_lock lock{wait_mutex};
+    if (usec == nullptr || *usec == 0) {
+        wait_cv.wait(lock, pred);
+        return true;
+    }
+    return wait_cv.wait_for(lock, std::chrono::microseconds(*usec), pred);
+}
 
 s32 PS4_SYSV_ABI sceKernelAioInitializeImpl(void* p, s32 size) {
 
@@ -28,7 +304,9 @@ s32 PS4_SYSV_ABI sceKernelAioDeleteRequest(OrbisKernelAioSubmitId id, s32* ret)
     if (ret == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    id_state[id] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+    if (GetRequest(id)) {
+        CancelRequest(id);
+    }
     *ret = 0;
     return 0;
 }
@@ -38,17 +316,24 @@ s32 PS4_SYSV_ABI sceKernelAioDeleteRequests(OrbisKernelAioSubmitId id[], s32 num
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
     for (s32 i = 0; i < num; i++) {
-        id_state[id[i]] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+        if (GetRequest(id[i])) {
+            CancelRequest(id[i]);
+        }
         ret[i] = 0;
     }
 
     return 0;
 }
+
 s32 PS4_SYSV_ABI sceKernelAioPollRequest(OrbisKernelAioSubmitId id, s32* state) {
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    *state = id_state[id];
+    const auto* request = GetRequest(id);
+    if (!request) {
+        return ORBIS_KERNEL_ERROR_EINVAL;
+    }
+    *state = request->state.load(std::memory_order_acquire);
     return 0;
 }
 
@@ -57,7 +342,8 @@ s32 PS4_SYSV_ABI sceKernelAioPollRequests(OrbisKernelAioSubmitId id[], s32 num,
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
     for (s32 i = 0; i < num; i++) {
-        state[i] = id_state[id[i]];
+        const auto* request = GetRequest(id[i]);
+        state[i] = request ? request->state.load(std::memory_order_acquire) : 0;
     }
 
     return 0;
@@ -67,9 +353,8 @@ s32 PS4_SYSV_ABI sceKernelAioCancelRequest(OrbisKernelAioSubmitId id, s32* state
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    if (id) {
-        id_state[id] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-        *state = ORBIS_KERNEL_AIO_STATE_ABORTED;
+    if (GetRequest(id)) {
+        *state = CancelRequest(id);
     } else {
         *state = ORBIS_KERNEL_AIO_STATE_PROCESSING;
     }
@@ -81,9 +366,8 @@ s32 PS4_SYSV_ABI sceKernelAioCancelRequests(OrbisKernelAioSubmitId id[], s32 num
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
     for (s32 i = 0; i < num; i++) {
-        if (id[i]) {
-            id_state[id[i]] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            state[i] = ORBIS_KERNEL_AIO_STATE_ABORTED;
+        if (GetRequest(id[i])) {
+            state[i] = CancelRequest(id[i]);
         } else {
             state[i] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
         }
@@ -96,25 +380,14 @@ s32 PS4_SYSV_ABI sceKernelAioWaitRequest(OrbisKernelAioSubmitId id, s32* state,
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    u32 timer = 0;
-
-    s32 timeout = 0;
-
-    while (id_state[id] == ORBIS_KERNEL_AIO_STATE_PROCESSING) {
-        sceKernelUsleep(10);
-
-        timer += 10;
-        if (*usec) {
-            if (timer > *usec) {
-                timeout = 1;
-                break;
-            }
-        }
+    const auto* request = GetRequest(id);
+    if (!request) {
+        return ORBIS_KERNEL_ERROR_EINVAL;
     }
 
-    *state = id_state[id];
-
-    if (timeout)
+    const bool done = WaitForRequests([id] { return !IsPending(id); }, usec);
+    *state = request->state.load(std::memory_order_acquire);
+    if (!done)
         return ORBIS_KERNEL_ERROR_ETIMEDOUT;
     return 0;
 }
@@ -124,34 +397,23 @@ s32 PS4_SYSV_ABI sceKernelAioWaitRequests(OrbisKernelAioSubmitId id[], s32 num,
     if (state == nullptr) {
         return ORBIS_KERNEL_ERROR_EFAULT;
     }
-    u32 timer = 0;
-    s32 timeout = 0;
-    s32 completion = 0;
-
-    for (s32 i = 0; i < num; i++) {
-        if (!completion && !timeout) {
-            while (id_state[id[i]] == ORBIS_KERNEL_AIO_STATE_PROCESSING) {
-                sceKernelUsleep(10);
-                timer += 10;
-
-                if (*usec) {
-                    if (timer > *usec) {
-                        timeout = 1;
-                        break;
-                    }
-                }
-            }
-        }
 
-        if (mode == 0x02) {
-            if (id_state[id[i]] == ORBIS_KERNEL_AIO_STATE_COMPLETED)
-                completion = 1;
-        }
+    // Mode 0x02 returns as soon as any of the requests is done, otherwise all of them have to be.
+    const auto ids = std::span{id, static_cast<size_t>(std::max(num, 0))};
+    const bool done = WaitForRequests(
+        [&] {
+            const auto is_done = [](OrbisKernelAioSubmitId id) { return !IsPending(id); };
+            return mode == 0x02 ? std::ranges::any_of(ids, is_done)
+                                : std::ranges::all_of(ids, is_done);
+        },
+        usec);
 
-        state[i] = id_state[id[i]];
+    for (s32 i = 0; i < num; i++) {
+        const auto* request = GetRequest(id[i]);
+        state[i] = request ? request->state.load(std::memory_order_acquire) : 0;
     }
 
-    if (timeout)
+    if (!done)
         return ORBIS_KERNEL_ERROR_ETIMEDOUT;
 
     return 0;
@@ -159,147 +421,22 @@ s32 PS4_SYSV_ABI sceKernelAioWaitRequests(OrbisKernelAioSubmitId id[], s32 num,
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitReadCommands(OrbisKernelAioRWRequest req[], s32 size, s32 prio,
                                                 OrbisKernelAioSubmitId* id) {
-    if (req == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    if (id == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-    for (s32 i = 0; i < size; i++) {
-
-        s64 ret = sceKernelPread(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-        }
-    }
-
-    id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-
-    *id = id_index;
-
-    id_index = (id_index + 1) % MAX_QUEUE;
-
-    if (!id_index)
-        id_index++;
-
-    return 0;
+    return SubmitCommands(req, size, prio, id, false, false);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitReadCommandsMultiple(OrbisKernelAioRWRequest req[], s32 size,
                                                         s32 prio, OrbisKernelAioSubmitId id[]) {
-    if (req == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    if (id == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-        s64 ret = sceKernelPread(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-
-        id[i] = id_index;
-
-        id_index = (id_index + 1) % MAX_QUEUE;
-
-        if (!id_index)
-            id_index++;
-    }
-
-    return 0;
+    return SubmitCommands(req, size, prio, id, false, true);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommands(OrbisKernelAioRWRequest req[], s32 size, s32 prio,
                                                  OrbisKernelAioSubmitId* id) {
-    if (req == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    if (id == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-
-        s64 ret = sceKernelPwrite(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-    }
-
-    *id = id_index;
-
-    id_index = (id_index + 1) % MAX_QUEUE;
-
-    // skip id_index equals 0 , because sceKernelAioCancelRequest will submit id
-    // equal to 0
-    if (!id_index)
-        id_index++;
-
-    return 0;
+    return SubmitCommands(req, size, prio, id, true, false);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSubmitWriteCommandsMultiple(OrbisKernelAioRWRequest req[], s32 size,
                                                          s32 prio, OrbisKernelAioSubmitId id[]) {
-    if (req == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    if (id == nullptr) {
-        return ORBIS_KERNEL_ERROR_EFAULT;
-    }
-    for (s32 i = 0; i < size; i++) {
-        id_state[id_index] = ORBIS_KERNEL_AIO_STATE_PROCESSING;
-        s64 ret = sceKernelPwrite(req[i].fd, req[i].buf, req[i].nbyte, req[i].offset);
-
-        if (ret < 0) {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_ABORTED;
-            req[i].result->returnValue = ret;
-
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_ABORTED;
-
-        } else {
-            req[i].result->state = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-            req[i].result->returnValue = ret;
-            id_state[id_index] = ORBIS_KERNEL_AIO_STATE_COMPLETED;
-        }
-
-        id[i] = id_index;
-        id_index = (id_index + 1) % MAX_QUEUE;
-
-        if (!id_index)
-            id_index++;
-    }
-    return 0;
+    return SubmitCommands(req, size, prio, id, true, true);
 }
 
 s32 PS4_SYSV_ABI sceKernelAioSetParam() {
@@ -313,10 +450,6 @@ s32 PS4_SYSV_ABI sceKernelAioInitializeParam() {
 }
 
 void RegisterAio(Core::Loader::SymbolsResolver* sym) {
-    id_index = 1;
-    id_state = (int*)malloc(sizeof(int) * MAX_QUEUE);
-    memset(id_state, 0, sizeof(sizeof(int) * MAX_QUEUE));
-
     LIB_FUNCTION("fR521KIGgb8", "libkernel", 1, "libkernel", sceKernelAioCancelRequest);
     LIB_FUNCTION("3Lca1XBrQdY", "libkernel", 1, "libkernel", sceKernelAioCancelRequests);
     LIB_FUNCTION("5TgME6AYty4", "libkernel", 1, "libkernel", sceKernelAioDeleteRequest);
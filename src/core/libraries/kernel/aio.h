@@ -17,6 +17,12 @@ class SymbolsResolver;
 
 namespace Libraries::Kernel {
 
+enum AioPriority {
+    ORBIS_KERNEL_AIO_PRIORITY_LOW = 1,
+    ORBIS_KERNEL_AIO_PRIORITY_MID = 2,
+    ORBIS_KERNEL_AIO_PRIORITY_HIGH = 3
+};
+
 enum AioState {
     ORBIS_KERNEL_AIO_STATE_SUBMITTED = 1,
     ORBIS_KERNEL_AIO_STATE_PROCESSING = 2,
@@ -17,8 +17,6 @@ extern void KernelSignalRequest();
 
 static constexpr auto HrTimerSpinlockThresholdUs = 1200u;
 
-// Events are uniquely identified by id and filter.
-
 bool EqueueInternal::AddEvent(EqueueEvent& event) {
     std::scoped_lock lock{m_mutex};
 
@@ -40,11 +38,15 @@ bool EqueueInternal::AddEvent(EqueueEvent& event) {
         event.event.flags |= SceKernelEvent::Flags::Clear;
     }
 
-    const auto& it = std::ranges::find(m_events, event);
-    if (it != m_events.cend()) {
-        *it = std::move(event);
-    } else {
-        m_events.emplace_back(std::move(event));
+    const EventKey key{event.event.ident, event.event.filter};
+    auto [it, inserted] = m_events.try_emplace(key);
+    EqueueEvent& stored = it->second;
+    // The hook is not moved along with the event, relink the replacement if needed.
+    stored.ready_hook.unlink();
+    stored = std::move(event);
+    if (stored.IsTriggered()) {
+        m_ready.push_back(stored);
+        WakeWaiter();
     }
 
     return true;
@@ -54,26 +56,24 @@ bool EqueueInternal::ScheduleEvent(u64 id, s16 filter,
                                    void (*callback)(SceKernelEqueue, const SceKernelEvent&)) {
     std::scoped_lock lock{m_mutex};
 
-    const auto& it = std::ranges::find_if(m_events, [id, filter](auto& ev) {
-        return ev.event.ident == id && ev.event.filter == filter;
-    });
-    if (it == m_events.cend()) {
+    const auto it = m_events.find({id, filter});
+    if (it == m_events.end()) {
         return false;
     }
 
-    const auto& event = *it;
+    auto& event = it->second;
     ASSERT(event.event.filter == SceKernelEvent::Filter::Timer ||
            event.event.filter == SceKernelEvent::Filter::HrTimer);
 
-    if (!it->timer) {
-        it->timer = std::make_unique<boost::asio::steady_timer>(io_context, event.timer_interval);
+    if (!event.timer) {
+        event.timer = std::make_unique<boost::asio::steady_timer>(io_context, event.timer_interval);
     } else {
         // If the timer already exists we are scheduling a reoccurrence after the next period.
         // Set the expiration time to the previous occurrence plus the period.
-        it->timer->expires_at(it->timer->expiry() + event.timer_interval);
+        event.timer->expires_at(event.timer->expiry() + event.timer_interval);
     }
 
-    it->timer->async_wait(
+    event.timer->async_wait(
         [this, event_data = event.event, callback](const boost::system::error_code& ec) {
             if (ec) {
                 if (ec != boost::system::errc::operation_canceled) {
@@ -92,23 +92,16 @@ bool EqueueInternal::ScheduleEvent(u64 id, s16 filter,
 }
 
 bool EqueueInternal::RemoveEvent(u64 id, s16 filter) {
-    bool has_found = false;
     std::scoped_lock lock{m_mutex};
-
-    const auto& it = std::ranges::find_if(m_events, [id, filter](auto& ev) {
-        return ev.event.ident == id && ev.event.filter == filter;
-    });
-    if (it != m_events.cend()) {
-        m_events.erase(it);
-        has_found = true;
-    }
-    return has_found;
+    // Erasing the event also unlinks it from the ready list.
+    return m_events.erase({id, filter}) > 0;
 }
 
 int EqueueInternal::WaitForEvents(SceKernelEvent* ev, int num, const SceKernelUseconds* timo) {
     if (timo != nullptr && *timo == 0) {
         // Effectively acts as a poll; only events that have already
         // arrived at the time of this function call can be received
+        std::scoped_lock lock{m_mutex};
         return GetTriggeredEvents(ev, num);
     }
     const auto micros = timo ? *timo : 0u;
@@ -118,27 +111,35 @@ int EqueueInternal::WaitForEvents(SceKernelEvent* ev, int num, const SceKernelUs
         return WaitForSmallTimer(ev, num, micros);
     }
 
+    const auto wait_start = std::chrono::steady_clock::now();
+    const auto deadline = wait_start + std::chrono::microseconds(micros);
     int count = 0;
-
-    const auto predicate = [&] {
-        count = GetTriggeredEvents(ev, num);
-        return count > 0;
-    };
-
-    if (micros == 0) {
-        // Wait indefinitely for events
-        std::unique_lock lock{m_mutex};
-        m_cond.wait(lock, predicate);
-    } else {
-        // Wait up until the timeout value
+    {
         std::unique_lock lock{m_mutex};
-        m_cond.wait_for(lock, std::chrono::microseconds(micros), predicate);
+        while ((count = GetTriggeredEvents(ev, num)) == 0) {
+            // Each waiter sleeps on its own condition, a trigger wakes exactly one of them.
+            Waiter waiter;
+            m_waiters.push_back(waiter);
+            const auto is_signaled = [&waiter] { return waiter.signaled; };
+            if (micros == 0) {
+                // Wait indefinitely for events
+                waiter.cv.wait(lock, is_signaled);
+            } else if (!waiter.cv.wait_until(lock, deadline, is_signaled)) {
+                // Timed out, take whatever arrived in the meantime
+                count = GetTriggeredEvents(ev, num);
+                break;
+            }
+        }
+        if (!m_ready.empty()) {
+            // Hand the events this waiter left behind to the next one.
+            WakeWaiter();
+        }
     }
 
     if (HasSmallTimer()) {
         if (count > 0) {
             const auto time_waited = std::chrono::duration_cast<std::chrono::microseconds>(
-                                         std::chrono::steady_clock::now() - m_events[0].time_added)
+                                         std::chrono::steady_clock::now() - wait_start)
                                          .count();
             count = WaitForSmallTimer(ev, num, std::max(0l, long(micros - time_waited)));
         }
@@ -148,44 +149,41 @@ int EqueueInternal::WaitForEvents(SceKernelEvent* ev, int num, const SceKernelUs
 }
 
 bool EqueueInternal::TriggerEvent(u64 ident, s16 filter, void* trigger_data) {
-    bool has_found = false;
-    {
-        std::scoped_lock lock{m_mutex};
-        for (auto& event : m_events) {
-            if (event.event.ident == ident && event.event.filter == filter) {
-                if (filter == SceKernelEvent::Filter::VideoOut) {
-                    event.TriggerDisplay(trigger_data);
-                } else if (filter == SceKernelEvent::Filter::User) {
-                    event.TriggerUser(trigger_data);
-                } else {
-                    event.Trigger(trigger_data);
-                }
-                has_found = true;
-            }
-        }
+    std::scoped_lock lock{m_mutex};
+    const auto it = m_events.find({ident, filter});
+    if (it == m_events.end()) {
+        return false;
+    }
+    auto& event = it->second;
+    if (filter == SceKernelEvent::Filter::VideoOut) {
+        event.TriggerDisplay(trigger_data);
+    } else if (filter == SceKernelEvent::Filter::User) {
+        event.TriggerUser(trigger_data);
+    } else {
+        event.Trigger(trigger_data);
     }
-    m_cond.notify_one();
-    return has_found;
+    if (!event.ready_hook.is_linked()) {
+        m_ready.push_back(event);
+        WakeWaiter();
+    }
+    return true;
 }
 
 int EqueueInternal::GetTriggeredEvents(SceKernelEvent* ev, int num) {
     int count = 0;
-    for (auto it = m_events.begin(); it != m_events.end();) {
-        if (it->IsTriggered()) {
-            ev[count++] = it->event;
-            if (it->event.flags & SceKernelEvent::Flags::Clear) {
-                it->Clear();
-            }
-            if (it->event.flags & SceKernelEvent::Flags::OneShot) {
-                it = m_events.erase(it);
-            } else {
-                ++it;
-            }
-
-            if (count == num) {
-                break;
-            }
+    for (auto it = m_ready.begin(); it != m_ready.end() && count < num;) {
+        EqueueEvent& event = *it;
+        ev[count++] = event.event;
+        if (event.event.flags & SceKernelEvent::Flags::Clear) {
+            event.Clear();
+        }
+        if (event.event.flags & SceKernelEvent::Flags::OneShot) {
+            it = m_ready.erase(it);
+            m_events.erase({event.event.ident, event.event.filter});
+        } else if (!event.IsTriggered()) {
+            it = m_ready.erase(it);
         } else {
+            // Events without the clear flag stay triggered until they are removed.
             ++it;
         }
     }
@@ -193,6 +191,16 @@ int EqueueInternal::GetTriggeredEvents(SceKernelEvent* ev, int num) {
     return count;
 }
 
+void EqueueInternal::WakeWaiter() {
+    if (m_waiters.empty()) {
+        return;
+    }
+    Waiter& waiter = m_waiters.front();
+    m_waiters.pop_front();
+    waiter.signaled = true;
+    waiter.cv.notify_one();
+}
+
 bool EqueueInternal::AddSmallTimer(EqueueEvent& ev) {
     SmallTimer st;
     st.event = ev.event;
@@ -238,12 +246,7 @@ int EqueueInternal::WaitForSmallTimer(SceKernelEvent* ev, int num, u32 micros) {
 
 bool EqueueInternal::EventExists(u64 id, s16 filter) {
     std::scoped_lock lock{m_mutex};
-
-    const auto& it = std::ranges::find_if(m_events, [id, filter](auto& ev) {
-        return ev.event.ident == id && ev.event.filter == filter;
-    });
-
-    return it != m_events.cend();
+    return m_events.contains({id, filter});
 }
 
 int PS4_SYSV_ABI sceKernelCreateEqueue(SceKernelEqueue* eq, const char* name) {
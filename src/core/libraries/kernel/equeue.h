@@ -6,10 +6,11 @@
 #include <condition_variable>
 #include <mutex>
 #include <string>
-#include <vector>
 #include <boost/asio/steady_timer.hpp>
+#include <boost/intrusive/list.hpp>
 
 #include <unordered_map>
+#include "common/hash.h"
 #include "common/rdtsc.h"
 #include "common/types.h"
 
@@ -77,12 +78,16 @@ struct OrbisVideoOutEventData {
     u64 flip_arg : 48;
 };
 
+using EqueueListHook =
+    boost::intrusive::list_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+
 struct EqueueEvent {
     SceKernelEvent event;
     void* data = nullptr;
     std::chrono::steady_clock::time_point time_added;
     std::chrono::microseconds timer_interval;
     std::unique_ptr<boost::asio::steady_timer> timer;
+    EqueueListHook ready_hook; ///< Links the event into the ready list of its queue.
 
     void Clear() {
         is_triggered = false;
@@ -138,6 +143,36 @@ class EqueueInternal {
         std::chrono::microseconds interval;
     };
 
+    // Events are uniquely identified by id and filter.
+    struct EventKey {
+        u64 ident;
+        s16 filter;
+
+        bool operator==(const EventKey&) const = default;
+    };
+
+    struct EventKeyHash {
+        size_t operator()(const EventKey& key) const noexcept {
+            return HashCombine(key.ident, static_cast<u64>(static_cast<u16>(key.filter)));
+        }
+    };
+
+    /// A thread blocked in WaitForEvents, woken on its own when an event becomes ready.
+    struct Waiter {
+        EqueueListHook hook;
+        std::condition_variable cv;
+        bool signaled = false;
+    };
+
+    using ReadyList =
+        boost::intrusive::list<EqueueEvent,
+                               boost::intrusive::member_hook<EqueueEvent, EqueueListHook,
+                                                             &EqueueEvent::ready_hook>,
+                               boost::intrusive::constant_time_size<false>>;
+    using WaiterList = boost::intrusive::list<
+        Waiter, boost::intrusive::member_hook<Waiter, EqueueListHook, &Waiter::hook>,
+        boost::intrusive::constant_time_size<false>>;
+
 public:
     explicit EqueueInternal(std::string_view name) : m_name(name) {}
 
@@ -171,10 +206,14 @@ public:
     bool EventExists(u64 id, s16 filter);
 
 private:
+    /// Wakes the longest waiting thread, if any. Must be called with m_mutex held.
+    void WakeWaiter();
+
     std::string m_name;
     std::mutex m_mutex;
-    std::vector<EqueueEvent> m_events;
-    std::condition_variable m_cond;
+    std::unordered_map<EventKey, EqueueEvent, EventKeyHash> m_events;
+    ReadyList m_ready;    ///< Triggered events, in the order they were triggered.
+    WaiterList m_waiters; ///< Blocked waiters, oldest first.
     std::unordered_map<u64, SmallTimer> m_small_timers;
 };
 
@@ -1,11 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstring>
 #include <map>
 #include <ranges>
 #include <magic_enum/magic_enum.hpp>
 
 #include "common/assert.h"
+#include "common/config.h"
 #include "common/error.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
@@ -149,6 +151,7 @@ s32 PS4_SYSV_ABI open(const char* raw_path, s32 flags, u16 mode) {
             }
             // Create a file if it doesn't exist
             Common::FS::IOFile out(file->m_host_name, Common::FS::FileAccessMode::Create);
+            mnt->InvalidateHostPath(file->m_host_name);
         }
     } else if (!exists) {
         // If we're not creating a file, and it doesn't exist, return ENOENT
@@ -215,6 +218,10 @@ s32 PS4_SYSV_ABI open(const char* raw_path, s32 flags, u16 mode) {
         if (read) {
             // Open exclusively for reading
             e = file->f.Open(file->m_host_name, Common::FS::FileAccessMode::Read);
+            if (e == 0 && read_only && Config::isMapGameFilesEnabled()) {
+                // Game files can't change, positional reads may copy straight from a mapping.
+                file->mapping = h->GetMappedFile(file->m_host_name);
+            }
         } else if (read_only) {
             // Can't open files with write/read-write access in a read only directory
             h->DeleteHandle(handle);
@@ -349,6 +356,63 @@ s64 ReadFile(Common::FS::IOFile& file, void* buf, u64 nbytes) {
     return file.ReadRaw<u8>(buf, nbytes);
 }
 
+s64 ReadMappedFileAt(const Common::FS::MappedFile& mapping, const OrbisKernelIovec* iov,
+                     s32 iovcnt, s64 offset) {
+    // Reads this large start the whole range in, instead of faulting it in page by page.
+    constexpr u64 PrefetchThreshold = 256_KB;
+
+    const auto* memory = Core::Memory::Instance();
+    const auto data = mapping.Data();
+    u64 total_size = 0;
+    for (s32 i = 0; i < iovcnt; i++) {
+        total_size += iov[i].iov_len;
+    }
+    if (total_size >= PrefetchThreshold) {
+        mapping.Prefetch(offset, total_size);
+    }
+
+    s64 total_read = 0;
+    for (s32 i = 0; i < iovcnt; i++) {
+        const u64 position = offset + total_read;
+        const u64 remaining = data.size() > position ? data.size() - position : 0;
+        const u64 length = std::min<u64>(iov[i].iov_len, remaining);
+        memory->InvalidateMemory(reinterpret_cast<VAddr>(iov[i].iov_base), length);
+        std::memcpy(iov[i].iov_base, data.data() + position, length);
+        total_read += length;
+        if (length < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total_read;
+}
+
+s64 ReadFileAt(Common::FS::IOFile& file, const OrbisKernelIovec* iov, s32 iovcnt, s64 offset) {
+    const auto* memory = Core::Memory::Instance();
+    const u64 file_size = file.GetSizeAt();
+    s64 total_read = 0;
+    for (s32 i = 0; i < iovcnt; i++) {
+        const u64 position = offset + total_read;
+        // Invalidate up to the actual number of bytes that could be read.
+        const u64 remaining = file_size > position ? file_size - position : 0;
+        memory->InvalidateMemory(reinterpret_cast<VAddr>(iov[i].iov_base),
+                                 std::min<u64>(iov[i].iov_len, remaining));
+
+        const s64 read = file.ReadAt(iov[i].iov_base, iov[i].iov_len, position);
+        if (read < 0) {
+            if (total_read > 0) {
+                break;
+            }
+            *__Error() = POSIX_EIO;
+            return -1;
+        }
+        total_read += read;
+        if (static_cast<u64>(read) < iov[i].iov_len) {
+            break;
+        }
+    }
+    return total_read;
+}
+
 s64 PS4_SYSV_ABI readv(s32 fd, const OrbisKernelIovec* iov, s32 iovcnt) {
     auto* h = Common::Singleton<Core::FileSys::HandleTable>::Instance();
     auto* file = h->GetFile(fd);
@@ -591,6 +655,7 @@ s32 PS4_SYSV_ABI posix_mkdir(const char* path, u16 mode) {
         *__Error() = POSIX_EIO;
         return -1;
     }
+    mnt->InvalidateHostPath(dir_name);
 
     if (!fs::exists(dir_name)) {
         *__Error() = POSIX_ENOENT;
@@ -635,6 +700,7 @@ s32 PS4_SYSV_ABI posix_rmdir(const char* path) {
 
     std::error_code ec;
     s32 result = fs::remove_all(dir_name, ec);
+    mnt->InvalidateHostPath(dir_name);
 
     if (ec) {
         *__Error() = POSIX_EIO;
@@ -661,8 +727,10 @@ s32 PS4_SYSV_ABI posix_stat(const char* path, OrbisKernelStat* sb) {
     auto* mnt = Common::Singleton<Core::FileSys::MntPoints>::Instance();
     const auto path_name = mnt->GetHostPath(path);
     std::memset(sb, 0, sizeof(OrbisKernelStat));
-    const bool is_dir = fs::is_directory(path_name);
-    const bool is_file = fs::is_regular_file(path_name);
+    std::error_code ec;
+    const auto status = fs::status(path_name, ec);
+    const bool is_dir = fs::is_directory(status);
+    const bool is_file = fs::is_regular_file(status);
     if (!is_dir && !is_file) {
         *__Error() = POSIX_ENOENT;
         return -1;
@@ -675,7 +743,7 @@ s32 PS4_SYSV_ABI posix_stat(const char* path, OrbisKernelStat* sb) {
     const auto mtime = fs::last_write_time(path_name);
     const auto mtimestamp = now_sys + (mtime - now_file);
 
-    if (fs::is_directory(path_name)) {
+    if (is_dir) {
         sb->st_mode = 0000777u | 0040000u;
         sb->st_size = 65536;
         sb->st_blksize = 65536;
@@ -907,6 +975,8 @@ s32 PS4_SYSV_ABI posix_rename(const char* from, const char* to) {
     } else {
         fs::remove_all(src_path);
     }
+    mnt->InvalidateHostPath(src_path);
+    mnt->InvalidateHostPath(dst_path);
 
     return ORBIS_OK;
 }
@@ -933,8 +1003,8 @@ s64 PS4_SYSV_ABI posix_preadv(s32 fd, OrbisKernelIovec* iov, s32 iovcnt, s64 off
         return -1;
     }
 
-    std::scoped_lock lk{file->m_mutex};
     if (file->type == Core::FileSys::FileType::Device) {
+        std::scoped_lock lk{file->m_mutex};
         s64 result = file->device->preadv(iov, iovcnt, offset);
         if (result < 0) {
             ErrSceToPosix(result);
@@ -942,6 +1012,7 @@ s64 PS4_SYSV_ABI posix_preadv(s32 fd, OrbisKernelIovec* iov, s32 iovcnt, s64 off
         }
         return result;
     } else if (file->type == Core::FileSys::FileType::Directory) {
+        std::scoped_lock lk{file->m_mutex};
         s64 result = file->directory->preadv(iov, iovcnt, offset);
         if (result < 0) {
             ErrSceToPosix(result);
@@ -955,19 +1026,12 @@ s64 PS4_SYSV_ABI posix_preadv(s32 fd, OrbisKernelIovec* iov, s32 iovcnt, s64 off
         return -1;
     }
 
-    const s64 pos = file->f.Tell();
-    SCOPE_EXIT {
-        file->f.Seek(pos);
-    };
-    if (!file->f.Seek(offset)) {
-        *__Error() = POSIX_EIO;
-        return -1;
-    }
-    s64 total_read = 0;
-    for (s32 i = 0; i < iovcnt; i++) {
-        total_read += ReadFile(file->f, iov[i].iov_base, iov[i].iov_len);
+    // Positional reads neither use nor move the file position, so readers of the same file don't
+    // need to serialize on its mutex.
+    if (file->mapping) {
+        return ReadMappedFileAt(*file->mapping, iov, iovcnt, offset);
     }
-    return total_read;
+    return ReadFileAt(file->f, iov, iovcnt, offset);
 }
 
 s64 PS4_SYSV_ABI sceKernelPreadv(s32 fd, OrbisKernelIovec* iov, s32 iovcnt, s64 offset) {
@@ -1119,17 +1183,18 @@ s64 PS4_SYSV_ABI posix_pwritev(s32 fd, const OrbisKernelIovec* iov, s32 iovcnt,
         return -1;
     }
 
-    const s64 pos = file->f.Tell();
-    SCOPE_EXIT {
-        file->f.Seek(pos);
-    };
-    if (!file->f.Seek(offset)) {
-        *__Error() = POSIX_EIO;
-        return -1;
-    }
     s64 total_written = 0;
     for (s32 i = 0; i < iovcnt; i++) {
-        total_written += file->f.WriteRaw<u8>(iov[i].iov_base, iov[i].iov_len);
+        const s64 written =
+            file->f.WriteAt(iov[i].iov_base, iov[i].iov_len, offset + total_written);
+        if (written < 0) {
+            if (total_written > 0) {
+                break;
+            }
+            *__Error() = POSIX_EIO;
+            return -1;
+        }
+        total_written += written;
     }
     return total_written;
 }
@@ -1195,6 +1260,7 @@ s32 PS4_SYSV_ABI posix_unlink(const char* path) {
     } else {
         file->f.Unlink();
     }
+    mnt->InvalidateHostPath(host_path);
 
     LOG_INFO(Kernel_Fs, "Unlinked {}", path);
     return ORBIS_OK;
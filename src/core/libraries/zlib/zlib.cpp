@@ -1,15 +1,20 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-#include <condition_variable>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <mutex>
-#include <stop_token>
+#include <thread>
 #include <unordered_map>
-#include <queue>
 #include <zlib.h>
 
+#include "common/assert.h"
+#include "common/bounded_threadsafe_queue.h"
+#include "common/config.h"
 #include "common/logging/log.h"
 #include "common/thread.h"
+#include "core/libraries/kernel/sync/semaphore.h"
 #include "core/libraries/kernel/threads.h"
 #include "core/libraries/libs.h"
 #include "core/libraries/zlib/zlib_error.h"
@@ -30,121 +35,157 @@ struct InflateResult {
     s32 status;
 };
 
-static Kernel::Thread task_thread;
+// Requests that have been submitted but not yet returned by sceZlibWaitForDone. Bounding them
+// keeps both queues from ever overflowing.
+constexpr u32 MaxPendingRequests = 1024;
+constexpr u32 MaxTaskThreads = 8;
 
-static std::mutex mutex;
-static std::queue<InflateTask> task_queue;
-static std::condition_variable_any task_queue_cv;
-static std::queue<u64> done_queue;
-static std::condition_variable_any done_queue_cv;
+static std::array<Kernel::Thread, MaxTaskThreads> task_threads;
+static u32 num_task_threads;
+static std::atomic_bool stopping;
+
+// Each queue is paired with a semaphore counting its published entries, so every finished request
+// wakes exactly one waiter.
+static Common::BoundedMPMCQueue<InflateTask, MaxPendingRequests> task_queue;
+static Kernel::CountingSemaphore task_queue_sem{0};
+static Common::BoundedMPMCQueue<u64, MaxPendingRequests> done_queue;
+static Kernel::CountingSemaphore done_queue_sem{0};
+static std::atomic<u32> pending_requests;
+
+static std::mutex results_mutex;
 static std::unordered_map<u64, InflateResult> results;
-static u64 next_request_id;
+static std::atomic<u64> next_request_id;
+
+template <typename T, size_t Capacity>
+static T PopPublished(Common::BoundedMPMCQueue<T, Capacity>& queue) {
+    // The semaphore guarantees an entry, but a producer that claimed an earlier slot may still be
+    // writing it.
+    T value;
+    while (!queue.TryPop(value)) {
+        std::this_thread::yield();
+    }
+    return value;
+}
 
-void ZlibTaskThread(const std::stop_token& stop) {
-    Common::SetCurrentThreadName("shadPS4:ZlibTaskThread");
+static InflateResult Inflate(z_stream& stream, const InflateTask& task) {
+    inflateReset(&stream);
+    stream.next_in = const_cast<Bytef*>(static_cast<const Bytef*>(task.src));
+    stream.avail_in = task.src_length;
+    stream.next_out = static_cast<Bytef*>(task.dst);
+    stream.avail_out = task.dst_length;
+    const auto ret = inflate(&stream, Z_FINISH);
+
+    // Same outcomes as uncompress, which a full output buffer reports as Z_BUF_ERROR.
+    return InflateResult{
+        .length = static_cast<u32>(stream.total_out),
+        .status = ret == Z_STREAM_END                       ? ORBIS_OK
+                  : ret == Z_BUF_ERROR && !stream.avail_out ? ORBIS_ZLIB_ERROR_NOSPACE
+                                                            : ORBIS_ZLIB_ERROR_FATAL,
+    };
+}
 
-    while (!stop.stop_requested()) {
-        InflateTask task;
-        {
-            // Lock and pop from the task queue, unless stop has been requested.
-            std::unique_lock lock(mutex);
-            if (!task_queue_cv.wait(lock, stop, [&] { return !task_queue.empty(); })) {
-                break;
-            }
-            task = task_queue.front();
-            task_queue.pop();
-        }
+void ZlibTaskThread(u32 index) {
+    Common::SetCurrentThreadName(fmt::format("shadPS4:ZlibTaskThread{}", index).c_str());
 
-        uLongf decompressed_length = task.dst_length;
-        const auto ret = uncompress(static_cast<Bytef*>(task.dst), &decompressed_length,
-                                    static_cast<const Bytef*>(task.src), task.src_length);
+    // Each worker keeps its inflate state, instead of allocating a new one for every request.
+    z_stream stream{};
+    const auto init_ret = inflateInit(&stream);
+    ASSERT_MSG(init_ret == Z_OK, "Failed to initialize inflate stream: {}", init_ret);
 
+    while (true) {
+        task_queue_sem.acquire();
+        if (stopping.load(std::memory_order_relaxed)) {
+            break;
+        }
+        const auto task = PopPublished(task_queue);
+        const auto result = Inflate(stream, task);
         {
-            // Lock, insert the new result, and push the finished request ID to the done queue.
-            std::unique_lock lock(mutex);
-            results[task.request_id] = InflateResult{
-                .length = static_cast<u32>(decompressed_length),
-                .status = ret == Z_BUF_ERROR ? ORBIS_ZLIB_ERROR_NOSPACE
-                          : ret == Z_OK      ? ORBIS_OK
-                                             : ORBIS_ZLIB_ERROR_FATAL,
-            };
-            done_queue.push(task.request_id);
+            std::scoped_lock lock{results_mutex};
+            results[task.request_id] = result;
         }
-        done_queue_cv.notify_one();
+        const bool pushed = done_queue.TryEmplace(task.request_id);
+        ASSERT(pushed);
+        done_queue_sem.release();
     }
+    inflateEnd(&stream);
 }
 
 s32 PS4_SYSV_ABI sceZlibInitialize(const void* buffer, u32 length) {
     LOG_INFO(Lib_Zlib, "called");
-    if (task_thread.Joinable()) {
+    if (task_threads[0].Joinable()) {
         return ORBIS_ZLIB_ERROR_ALREADY_INITIALIZED;
     }
 
     // Initialize with empty task data
-    task_queue = std::queue<InflateTask>();
-    done_queue = std::queue<u64>();
     results.clear();
     next_request_id = 1;
-
-    task_thread.Run([](const std::stop_token& stop) { ZlibTaskThread(stop); });
+    pending_requests = 0;
+    stopping = false;
+
+    const u32 configured = Config::getZlibWorkerThreads();
+    num_task_threads =
+        configured ? std::min(configured, MaxTaskThreads)
+                   : std::clamp(std::thread::hardware_concurrency() / 4, 1U, 4U);
+    for (u32 i = 0; i < num_task_threads; i++) {
+        task_threads[i].Run([i](const std::stop_token&) { ZlibTaskThread(i); });
+    }
+    LOG_INFO(Lib_Zlib, "Started {} inflate threads", num_task_threads);
     return ORBIS_OK;
 }
 
 s32 PS4_SYSV_ABI sceZlibInflate(const void* src, u32 src_len, void* dst, u32 dst_len,
                                 u64* request_id) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads[0].Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!src || !src_len || !dst || !dst_len || !request_id || dst_len > 64_KB ||
         dst_len % 2_KB != 0) {
         return ORBIS_ZLIB_ERROR_INVALID;
     }
-
-    {
-        std::unique_lock lock(mutex);
-        *request_id = next_request_id++;
-        task_queue.emplace(InflateTask{
-            .request_id = *request_id,
-            .src = src,
-            .src_length = src_len,
-            .dst = dst,
-            .dst_length = dst_len,
-        });
-        task_queue_cv.notify_one();
+    if (pending_requests.fetch_add(1, std::memory_order_relaxed) >= MaxPendingRequests) {
+        pending_requests.fetch_sub(1, std::memory_order_relaxed);
+        return ORBIS_ZLIB_ERROR_BUSY;
     }
+
+    *request_id = next_request_id.fetch_add(1, std::memory_order_relaxed);
+    const bool pushed = task_queue.TryEmplace(InflateTask{
+        .request_id = *request_id,
+        .src = src,
+        .src_length = src_len,
+        .dst = dst,
+        .dst_length = dst_len,
+    });
+    ASSERT(pushed);
+    task_queue_sem.release();
     return ORBIS_OK;
 }
 
 s32 PS4_SYSV_ABI sceZlibWaitForDone(u64* request_id, const u32* timeout) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads[0].Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!request_id) {
         return ORBIS_ZLIB_ERROR_INVALID;
     }
 
-    {
-        // Pop from the done queue, unless the timeout is reached.
-        std::unique_lock lock(mutex);
-        const auto pred = [] { return !done_queue.empty(); };
-        if (timeout) {
-            if (!done_queue_cv.wait_for(lock, std::chrono::milliseconds(*timeout), pred)) {
-                return ORBIS_ZLIB_ERROR_TIMEDOUT;
-            }
-        } else {
-            done_queue_cv.wait(lock, pred);
+    // Take one finished request, unless the timeout is reached.
+    if (timeout) {
+        if (!done_queue_sem.try_acquire_for(std::chrono::milliseconds(*timeout))) {
+            return ORBIS_ZLIB_ERROR_TIMEDOUT;
         }
-        *request_id = done_queue.front();
-        done_queue.pop();
+    } else {
+        done_queue_sem.acquire();
     }
+    *request_id = PopPublished(done_queue);
+    pending_requests.fetch_sub(1, std::memory_order_relaxed);
     return ORBIS_OK;
 }
 
 s32 PS4_SYSV_ABI sceZlibGetResult(const u64 request_id, u32* dst_length, s32* status) {
     LOG_DEBUG(Lib_Zlib, "(STUBBED) called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads[0].Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
     if (!dst_length || !status) {
@@ -152,23 +193,39 @@ s32 PS4_SYSV_ABI sceZlibGetResult(const u64 request_id, u32* dst_length, s32* st
     }
 
     {
-        std::unique_lock lock(mutex);
-        if (!results.contains(request_id)) {
+        std::scoped_lock lock{results_mutex};
+        const auto it = results.find(request_id);
+        if (it == results.end()) {
             return ORBIS_ZLIB_ERROR_NOT_FOUND;
         }
-        const auto result = results[request_id];
-        *dst_length = result.length;
-        *status = result.status;
+        *dst_length = it->second.length;
+        *status = it->second.status;
     }
     return ORBIS_OK;
 }
 
 s32 PS4_SYSV_ABI sceZlibFinalize() {
     LOG_INFO(Lib_Zlib, "called");
-    if (!task_thread.Joinable()) {
+    if (!task_threads[0].Joinable()) {
         return ORBIS_ZLIB_ERROR_NOT_INITIALIZED;
     }
-    task_thread.Stop();
+
+    // Wake every worker so it sees the stop flag, then drop whatever is still queued.
+    stopping = true;
+    for (u32 i = 0; i < num_task_threads; i++) {
+        task_queue_sem.release();
+    }
+    for (u32 i = 0; i < num_task_threads; i++) {
+        task_threads[i].Stop();
+    }
+    InflateTask task;
+    while (task_queue_sem.try_acquire()) {
+        task_queue.TryPop(task);
+    }
+    u64 request_id;
+    while (done_queue_sem.try_acquire()) {
+        done_queue.TryPop(request_id);
+    }
     return ORBIS_OK;
 }
 
@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright 2025-2026 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 #include "common/alignment.h"
 #include "common/arch.h"
 #include "common/assert.h"
@@ -23,10 +27,33 @@
 
 namespace Core {
 
+using Clock = std::chrono::steady_clock;
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
 static PS4_SYSV_ABI void ProgramExitFunc() {
     LOG_ERROR(Core_Linker, "Exit function called");
 }
 
+/// Runs func(i) for every i in [0, count) on a pool of worker threads.
+static void ParallelFor(size_t count, auto&& func) {
+    const size_t num_workers =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), count);
+    std::atomic<size_t> next_index{};
+    const auto worker = [&] {
+        for (size_t i = next_index++; i < count; i = next_index++) {
+            func(i);
+        }
+    };
+    std::vector<std::jthread> workers;
+    for (size_t i = 1; i < num_workers; ++i) {
+        workers.emplace_back([&worker, i] {
+            Common::SetCurrentThreadName(fmt::format("shadPS4:Loader{}", i).c_str());
+            worker();
+        });
+    }
+    worker();
+}
+
 #ifdef ARCH_X86_64
 static PS4_SYSV_ABI void* RunMainEntry [[noreturn]] (EntryParams* params) {
     // Start shared library modules
@@ -64,9 +91,20 @@ void Linker::Execute(const std::vector<std::string>& args) {
     Module* module = m_modules[0].get();
     static_tls_size = module->tls.offset = module->tls.image_size;
 
-    // Relocate all modules
-    for (const auto& m : m_modules) {
-        Relocate(m.get());
+    // Relocate all modules. Every module is loaded by now, so cross-module imports resolve.
+    const auto relocate = [this](size_t index) {
+        const auto start = Clock::now();
+        Module* m = m_modules[index].get();
+        Relocate(m);
+        LOG_INFO(Core_Linker, "Relocated module {} in {:.2f} ms", m->name,
+                 Milliseconds{Clock::now() - start}.count());
+    };
+    if (Config::isParallelModuleLoadingEnabled()) {
+        ParallelFor(m_modules.size(), relocate);
+    } else {
+        for (size_t i = 0; i < m_modules.size(); ++i) {
+            relocate(i);
+        }
     }
 
     // Configure the direct and flexible memory regions.
@@ -147,7 +185,77 @@ s32 Linker::LoadModule(const std::filesystem::path& elf_name, bool is_dynamic) {
         return -1;
     }
 
+    const auto start = Clock::now();
     auto module = std::make_unique<Module>(memory, elf_name, max_tls_index);
+    LOG_INFO(Core_Linker, "Loaded module {} in {:.2f} ms", module->name,
+             Milliseconds{Clock::now() - start}.count());
+    return AddModule(std::move(module), elf_name, is_dynamic);
+}
+
+std::vector<s32> Linker::LoadModules(std::span<const std::filesystem::path> elf_names) {
+    std::vector<s32> handles;
+    if (!Config::isParallelModuleLoadingEnabled() || elf_names.size() < 2) {
+        for (const auto& elf_name : elf_names) {
+            handles.push_back(LoadModule(elf_name));
+        }
+        return handles;
+    }
+
+    std::scoped_lock lk{mutex};
+
+    struct LoadTiming {
+        Clock::duration open;
+        Clock::duration map;
+        Clock::duration symbols;
+    };
+    std::vector<std::unique_ptr<Module>> modules(elf_names.size());
+    std::vector<LoadTiming> timings(elf_names.size());
+
+    // Opening the ELF files and parsing their symbols only touch the module itself. Mapping
+    // assigns base addresses and TLS indices, so it has to happen in load order.
+    ParallelFor(elf_names.size(), [&](size_t i) {
+        if (!std::filesystem::exists(elf_names[i])) {
+            return;
+        }
+        const auto start = Clock::now();
+        modules[i] = std::make_unique<Module>(memory, elf_names[i]);
+        timings[i].open = Clock::now() - start;
+    });
+    for (size_t i = 0; i < modules.size(); ++i) {
+        if (modules[i] && modules[i]->IsElfFile()) {
+            const auto start = Clock::now();
+            modules[i]->LoadModuleToMemory(max_tls_index);
+            timings[i].map = Clock::now() - start;
+        }
+    }
+    ParallelFor(elf_names.size(), [&](size_t i) {
+        if (modules[i] && modules[i]->IsValid()) {
+            const auto start = Clock::now();
+            modules[i]->LoadDynamicInfo();
+            modules[i]->LoadSymbols();
+            timings[i].symbols = Clock::now() - start;
+        }
+    });
+
+    for (size_t i = 0; i < modules.size(); ++i) {
+        if (!modules[i]) {
+            LOG_ERROR(Core_Linker, "Provided file {} does not exist", elf_names[i].string());
+            handles.push_back(-1);
+            continue;
+        }
+        const auto& timing = timings[i];
+        LOG_INFO(Core_Linker,
+                 "Loaded module {} in {:.2f} ms (open {:.2f} ms, map {:.2f} ms, symbols {:.2f} ms)",
+                 modules[i]->name, Milliseconds{timing.open + timing.map + timing.symbols}.count(),
+                 Milliseconds{timing.open}.count(), Milliseconds{timing.map}.count(),
+                 Milliseconds{timing.symbols}.count());
+        handles.push_back(AddModule(std::move(modules[i]), elf_names[i], false));
+    }
+    return handles;
+}
+
+s32 Linker::AddModule(std::unique_ptr<Module> module, const std::filesystem::path& elf_name,
+                      bool is_dynamic) {
     if (!module->IsValid()) {
         LOG_ERROR(Core_Linker, "Provided file {} is not valid ELF file", elf_name.string());
         return -1;
@@ -201,6 +309,7 @@ Module* Linker::FindByAddress(VAddr address) {
 }
 
 void Linker::Relocate(Module* module) {
+    const auto imports = ResolveImports(module);
     module->ForEachRelocation([&](elf_relocation* rel, u32 i, bool is_jmp_rel) {
         const u32 num_relocs = module->dynamic_info.relocation_table_size / sizeof(elf_relocation);
         const u32 bit_idx = (is_jmp_rel ? num_relocs : 0) + i;
@@ -211,7 +320,6 @@ void Linker::Relocate(Module* module) {
         auto symbol = rel->GetSymbol();
         auto addend = rel->rel_addend;
         auto* symbol_table = module->dynamic_info.symbol_table;
-        auto* names_tlb = module->dynamic_info.str_table;
 
         const VAddr rel_base_virtual_addr = module->GetBaseAddress();
         const VAddr rel_virtual_addr = rel_base_virtual_addr + rel->rel_offset;
@@ -241,7 +349,6 @@ void Linker::Relocate(Module* module) {
             auto sym_type = sym.GetType();
             auto sym_visibility = sym.GetVisibility();
             u64 symbol_virtual_addr = 0;
-            Loader::SymbolRecord symrec{};
             switch (sym_type) {
             case STT_FUN:
                 rel_sym_type = Loader::SymbolType::Function;
@@ -267,12 +374,13 @@ void Linker::Relocate(Module* module) {
                 break;
             case STB_GLOBAL:
             case STB_WEAK: {
-                rel_name = names_tlb + sym.st_name;
-                if (Resolve(rel_name, rel_sym_type, module, &symrec)) {
+                const auto& import = *imports[symbol];
+                if (import.is_resolved) {
                     // Only set the rela bit if the symbol was actually resolved and not stubbed.
                     module->SetRelaBit(bit_idx);
                 }
-                symbol_virtual_addr = symrec.virtual_address;
+                symbol_virtual_addr = import.record.virtual_address;
+                rel_name = import.record.name;
                 break;
             }
             default:
@@ -280,7 +388,6 @@ void Linker::Relocate(Module* module) {
             }
             rel_is_resolved = (symbol_virtual_addr != 0);
             rel_value = (rel_is_resolved ? symbol_virtual_addr + addend : 0);
-            rel_name = symrec.name;
             break;
         }
         default:
@@ -303,55 +410,103 @@ const Module* Linker::FindExportedModule(const ModuleInfo& module, const Library
     return it == m_modules.end() ? nullptr : it->get();
 }
 
-bool Linker::Resolve(const std::string& name, Loader::SymbolType sym_type, Module* m,
-                     Loader::SymbolRecord* return_info) {
-    const auto ids = Common::SplitString(name, '#');
-    if (ids.size() != 3) {
-        return_info->virtual_address = 0;
-        return_info->name = name;
-        LOG_ERROR(Core_Linker, "Not Resolved {}", name);
-        return false;
-    }
+std::vector<std::optional<Linker::ResolvedImport>> Linker::ResolveImports(Module* module) {
+    const auto* symbol_table = module->dynamic_info.symbol_table;
+    const auto* names_tlb = module->dynamic_info.str_table;
+    const u32 num_symbols = module->dynamic_info.symbol_table_total_size / sizeof(elf_symbol);
+    const u32 num_relocs = module->dynamic_info.relocation_table_size / sizeof(elf_relocation);
+    std::vector<std::optional<ResolvedImport>> imports(num_symbols);
+
+    // Relocations of a module tend to share symbols, so gather each symbol once and look them
+    // all up together.
+    struct ImportRequest {
+        u32 symbol;
+        const LibraryInfo* library;
+        const ModuleInfo* module;
+    };
+    std::vector<ImportRequest> requests;
+    std::vector<Loader::SymbolResolver> symbols;
+    module->ForEachRelocation([&](elf_relocation* rel, u32 i, bool is_jmp_rel) {
+        const u32 bit_idx = (is_jmp_rel ? num_relocs : 0) + i;
+        const auto type = rel->GetType();
+        if (module->TestRelaBit(bit_idx) ||
+            (type != R_X86_64_GLOB_DAT && type != R_X86_64_JUMP_SLOT && type != R_X86_64_64)) {
+            return;
+        }
+        const u32 symbol = rel->GetSymbol();
+        const auto& sym = symbol_table[symbol];
+        const auto sym_bind = sym.GetBind();
+        if ((sym_bind != STB_GLOBAL && sym_bind != STB_WEAK) || imports[symbol]) {
+            return;
+        }
 
-    const LibraryInfo* library = m->FindLibrary(ids[1]);
-    const ModuleInfo* module = m->FindModule(ids[2]);
-    ASSERT_MSG(library && module, "Unable to find library and module");
-
-    Loader::SymbolResolver sr{};
-    sr.name = ids.at(0);
-    sr.library = library->name;
-    sr.library_version = library->version;
-    sr.module = module->name;
-    sr.type = sym_type;
-
-    const auto* record = m_hle_symbols.FindSymbol(sr);
-    if (record) {
-        *return_info = *record;
-        Core::Devtools::Widget::ModuleList::AddModule(sr.library);
-        return true;
-    }
+        const std::string name = names_tlb + sym.st_name;
+        const auto ids = Common::SplitString(name, '#');
+        if (ids.size() != 3) {
+            imports[symbol] = ResolvedImport{.record{.name = name}, .is_resolved = false};
+            LOG_ERROR(Core_Linker, "Not Resolved {}", name);
+            return;
+        }
+
+        const LibraryInfo* library = module->FindLibrary(ids[1]);
+        const ModuleInfo* module_info = module->FindModule(ids[2]);
+        ASSERT_MSG(library && module_info, "Unable to find library and module");
+
+        Loader::SymbolResolver& sr = symbols.emplace_back();
+        sr.name = ids.at(0);
+        sr.library = library->name;
+        sr.library_version = library->version;
+        sr.module = module_info->name;
+        switch (sym.GetType()) {
+        case STT_FUN:
+            sr.type = Loader::SymbolType::Function;
+            break;
+        case STT_OBJECT:
+            sr.type = Loader::SymbolType::Object;
+            break;
+        default:
+            sr.type = Loader::SymbolType::NoType;
+            break;
+        }
+        requests.push_back({symbol, library, module_info});
+        imports[symbol].emplace();
+    });
 
-    // Check if it an export function
-    const auto* p = FindExportedModule(*module, *library);
-    if (p && p->export_sym.GetSize() > 0) {
-        record = p->export_sym.FindSymbol(sr);
-        if (record) {
-            *return_info = *record;
-            return true;
+    std::vector<const Loader::SymbolRecord*> records(symbols.size());
+    m_hle_symbols.FindSymbols(symbols, records);
+
+    for (size_t i = 0; i < requests.size(); i++) {
+        const auto& request = requests[i];
+        const auto& sr = symbols[i];
+        auto& import = *imports[request.symbol];
+        if (records[i]) {
+            import = {*records[i], true};
+            Core::Devtools::Widget::ModuleList::AddModule(sr.library);
+            continue;
         }
-    }
 
-    const auto aeronid = AeroLib::FindByNid(sr.name.c_str());
-    if (aeronid) {
-        return_info->name = aeronid->name;
-        return_info->virtual_address = AeroLib::GetStub(aeronid->nid);
-    } else {
-        return_info->virtual_address = AeroLib::GetStub(sr.name.c_str());
-        return_info->name = "Unknown !!!";
+        // Check if it an export function
+        const auto* p = FindExportedModule(*request.module, *request.library);
+        if (p && p->export_sym.GetSize() > 0) {
+            if (const auto* record = p->export_sym.FindSymbol(sr)) {
+                import = {*record, true};
+                continue;
+            }
+        }
+
+        const auto aeronid = AeroLib::FindByNid(sr.name.c_str());
+        if (aeronid) {
+            import.record.name = aeronid->name;
+            import.record.virtual_address = AeroLib::GetStub(aeronid->nid);
+        } else {
+            import.record.virtual_address = AeroLib::GetStub(sr.name.c_str());
+            import.record.name = "Unknown !!!";
+        }
+        import.is_resolved = false;
+        LOG_ERROR(Core_Linker, "Linker: Stub resolved {} as {} (lib: {}, mod: {})", sr.name,
+                  import.record.name, request.library->name, request.module->name);
     }
-    LOG_ERROR(Core_Linker, "Linker: Stub resolved {} as {} (lib: {}, mod: {})", sr.name,
-              return_info->name, library->name, module->name);
-    return false;
+    return imports;
 }
 
 void* Linker::TlsGetAddr(u64 module_index, u64 offset) {
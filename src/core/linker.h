@@ -4,7 +4,10 @@
 #pragma once
 
 #include <algorithm>
+#include <filesystem>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <vector>
 #include "core/libraries/kernel/threads.h"
 #include "core/module.h"
@@ -146,17 +149,29 @@ public:
     void FreeTlsForNonPrimaryThread(void* pointer);
 
     s32 LoadModule(const std::filesystem::path& elf_name, bool is_dynamic = false);
+    /// Loads a set of independent static modules, in parallel when enabled. Returns the handle
+    /// of each module, or -1 when it failed to load.
+    std::vector<s32> LoadModules(std::span<const std::filesystem::path> elf_names);
     s32 LoadAndStartModule(const std::filesystem::path& path, u64 args, const void* argp,
                            int* pRes);
     Module* FindByAddress(VAddr address);
 
     void Relocate(Module* module);
-    bool Resolve(const std::string& name, Loader::SymbolType type, Module* module,
-                 Loader::SymbolRecord* return_info);
     void Execute(const std::vector<std::string>& args = {});
     void DebugDump();
 
 private:
+    s32 AddModule(std::unique_ptr<Module> module, const std::filesystem::path& elf_name,
+                  bool is_dynamic);
+
+    struct ResolvedImport {
+        Loader::SymbolRecord record;
+        bool is_resolved;
+    };
+
+    /// Resolves every global symbol referenced by the pending relocations of a module, indexed
+    /// by symbol table entry. Unresolved symbols are pointed at a stub.
+    std::vector<std::optional<ResolvedImport>> ResolveImports(Module* module);
     const Module* FindExportedModule(const ModuleInfo& m, const LibraryInfo& l);
 
     MemoryManager* memory;
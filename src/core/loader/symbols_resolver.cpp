@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <fmt/format.h>
+#include "common/hash.h"
 #include "common/io_file.h"
 #include "common/string_util.h"
 #include "common/types.h"
@@ -10,7 +11,23 @@
 
 namespace Core::Loader {
 
+size_t SymbolsResolver::SymbolKeyHash::operator()(const SymbolKey& key) const noexcept {
+    const std::hash<std::string_view> hasher;
+    u64 hash = hasher(key.nid);
+    hash = HashCombine(hash, u64(hasher(key.library)));
+    hash = HashCombine(hash, u64(hasher(key.module)));
+    return HashCombine(hash, (u64(key.library_version) << 8) | u64(key.type));
+}
+
+std::string_view SymbolsResolver::Intern(std::string_view str) {
+    return *m_strings.emplace(str).first;
+}
+
 void SymbolsResolver::AddSymbol(const SymbolResolver& s, u64 virtual_addr) {
+    const SymbolKey key{Intern(s.name), Intern(s.library), Intern(s.module), s.library_version,
+                        s.type};
+    // Keep the first definition when a symbol is registered twice, like the old linear search.
+    m_index.try_emplace(key, static_cast<u32>(m_symbols.size()));
     m_symbols.emplace_back(GenerateName(s), s.nidName, virtual_addr);
 }
 
@@ -20,15 +37,20 @@ std::string SymbolsResolver::GenerateName(const SymbolResolver& s) {
 }
 
 const SymbolRecord* SymbolsResolver::FindSymbol(const SymbolResolver& s) const {
-    const std::string name = GenerateName(s);
-    for (u32 i = 0; i < m_symbols.size(); i++) {
-        if (m_symbols[i].name == name) {
-            return &m_symbols[i];
-        }
+    const auto it = m_index.find(MakeKey(s));
+    if (it == m_index.end()) {
+        // LOG_INFO(Core_Linker, "Unresolved! {}", GenerateName(s));
+        return nullptr;
     }
+    return &m_symbols[it->second];
+}
 
-    // LOG_INFO(Core_Linker, "Unresolved! {}", name);
-    return nullptr;
+void SymbolsResolver::FindSymbols(std::span<const SymbolResolver> symbols,
+                                  std::span<const SymbolRecord*> out) const {
+    ASSERT(symbols.size() == out.size());
+    for (size_t i = 0; i < symbols.size(); i++) {
+        out[i] = FindSymbol(symbols[i]);
+    }
 }
 
 void SymbolsResolver::DebugDump(const std::filesystem::path& file_name) {
@@ -6,7 +6,10 @@
 #include <filesystem>
 #include <span>
 #include <string>
+#include <string_view>
+#include <unordered_set>
 #include <vector>
+#include <tsl/robin_map.h>
 #include "common/assert.h"
 #include "common/types.h"
 
@@ -40,9 +43,16 @@ public:
     SymbolsResolver() = default;
     virtual ~SymbolsResolver() = default;
 
+    SymbolsResolver(const SymbolsResolver&) = delete;
+    SymbolsResolver& operator=(const SymbolsResolver&) = delete;
+
     void AddSymbol(const SymbolResolver& s, u64 virtual_addr);
     const SymbolRecord* FindSymbol(const SymbolResolver& s) const;
 
+    /// Looks up a batch of symbols, out[i] receives the record of symbols[i] or nullptr.
+    void FindSymbols(std::span<const SymbolResolver> symbols,
+                     std::span<const SymbolRecord*> out) const;
+
     void DebugDump(const std::filesystem::path& file_name);
 
     std::span<const SymbolRecord> GetSymbols() const {
@@ -73,7 +83,30 @@ public:
     }
 
 private:
+    /// Lookup key of a symbol, the views point into the interned strings.
+    struct SymbolKey {
+        std::string_view nid;
+        std::string_view library;
+        std::string_view module;
+        u16 library_version;
+        SymbolType type;
+
+        bool operator==(const SymbolKey&) const = default;
+    };
+
+    struct SymbolKeyHash {
+        size_t operator()(const SymbolKey& key) const noexcept;
+    };
+
+    static SymbolKey MakeKey(const SymbolResolver& s) {
+        return {s.name, s.library, s.module, s.library_version, s.type};
+    }
+
+    std::string_view Intern(std::string_view str);
+
     std::vector<SymbolRecord> m_symbols;
+    tsl::robin_map<SymbolKey, u32, SymbolKeyHash> m_index;
+    std::unordered_set<std::string> m_strings;
 };
 
 } // namespace Core::Loader
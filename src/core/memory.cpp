@@ -24,6 +24,7 @@ MemoryManager::MemoryManager() {
     for (auto region : regions) {
         vma_map.emplace(region.lower(),
                         VirtualMemoryArea{region.lower(), region.upper() - region.lower()});
+        free_ranges.Insert(region.lower(), region.upper() - region.lower());
         LOG_INFO(Kernel_Vmm, "{:#x} - {:#x}", region.lower(), region.upper());
     }
 
@@ -393,7 +394,7 @@ s32 MemoryManager::PoolCommit(VAddr virtual_addr, u64 size, MemoryProt prot, s32
     new_vma.disallow_merge = false;
     new_vma.prot = prot;
     new_vma.name = "anon";
-    new_vma.type = Core::VMAType::Pooled;
+    SetVMAType(new_vma, VMAType::Pooled);
     new_vma.phys_areas.clear();
 
     // Find suitable physical addresses
@@ -479,7 +480,7 @@ MemoryManager::VMAHandle MemoryManager::CreateArea(VAddr virtual_addr, u64 size,
     new_vma.disallow_merge = True(flags & MemoryMapFlags::NoCoalesce);
     new_vma.prot = prot;
     new_vma.name = name;
-    new_vma.type = type;
+    SetVMAType(new_vma, type);
     new_vma.phys_areas.clear();
     return new_vma_handle;
 }
@@ -810,7 +811,7 @@ s32 MemoryManager::PoolDecommit(VAddr virtual_addr, u64 size) {
         // Mark region as pool reserved and attempt to coalesce it with neighbours.
         const auto new_it = CarveVMA(current_addr, size_in_vma);
         auto& vma = new_it->second;
-        vma.type = VMAType::PoolReserved;
+        SetVMAType(vma, VMAType::PoolReserved);
         vma.prot = MemoryProt::NoAccess;
         vma.disallow_merge = false;
         vma.name = "anon";
@@ -904,7 +905,7 @@ u64 MemoryManager::UnmapBytesFromEntry(VAddr virtual_addr, VirtualMemoryArea vma
     // Mark region as free and attempt to coalesce it with neighbours.
     const auto new_it = CarveVMA(virtual_addr, size_in_vma);
     auto& vma = new_it->second;
-    vma.type = VMAType::Free;
+    SetVMAType(vma, VMAType::Free);
     vma.prot = MemoryProt::NoAccess;
     vma.phys_areas.clear();
     vma.disallow_merge = false;
@@ -1344,6 +1345,15 @@ void MemoryManager::InvalidateMemory(const VAddr addr, const u64 size) const {
     }
 }
 
+void MemoryManager::SetVMAType(VirtualMemoryArea& vma, VMAType type) {
+    if (vma.IsFree() && type != VMAType::Free) {
+        free_ranges.Erase(vma.base);
+    } else if (!vma.IsFree() && type == VMAType::Free) {
+        free_ranges.Insert(vma.base, vma.size);
+    }
+    vma.type = type;
+}
+
 VAddr MemoryManager::SearchFree(VAddr virtual_addr, u64 size, u32 alignment) {
     // Calculate the minimum and maximum addresses present in our address space.
     auto min_search_address = impl.SystemManagedVirtualBase();
@@ -1366,36 +1376,10 @@ VAddr MemoryManager::SearchFree(VAddr virtual_addr, u64 size, u32 alignment) {
         return virtual_addr;
     }
 
-    // If we didn't hit the return above, then we know the current VMA isn't suitable
-    it++;
-
-    // Search for the first free VMA that fits our mapping.
-    while (it != vma_map.end()) {
-        if (!it->second.IsFree()) {
-            it++;
-            continue;
-        }
-
-        const auto& vma = it->second;
-        virtual_addr = Common::AlignUp(vma.base, alignment);
-        // Sometimes the alignment itself might be larger than the VMA.
-        if (virtual_addr > vma.base + vma.size) {
-            it++;
-            continue;
-        }
-
-        // Make sure the address is within our defined bounds
-        if (virtual_addr >= max_search_address) {
-            // There are no free mappings within our safely usable address space.
-            break;
-        }
-
-        // If there's enough space in the VMA, return the address.
-        const u64 remaining_size = vma.base + vma.size - virtual_addr;
-        if (remaining_size >= size) {
-            return virtual_addr;
-        }
-        it++;
+    // Otherwise take the first free VMA after it that fits the aligned mapping.
+    const auto addr = free_ranges.FindFirstFit(it->second.base + 1, size, alignment);
+    if (addr && *addr < max_search_address) {
+        return *addr;
     }
 
     // Couldn't find a suitable VMA, return an error.
@@ -1412,6 +1396,10 @@ MemoryManager::VMAHandle MemoryManager::MergeAdjacent(VMAMap& handle_map, VMAHan
         for (auto& area : next_vma->second.phys_areas) {
             iter->second.phys_areas[base_offset + area.first] = area.second;
         }
+        if (iter->second.IsFree()) {
+            free_ranges.Erase(next_vma->second.base);
+            free_ranges.Resize(iter->second.base, iter->second.size);
+        }
         handle_map.erase(next_vma);
     }
 
@@ -1423,6 +1411,10 @@ MemoryManager::VMAHandle MemoryManager::MergeAdjacent(VMAMap& handle_map, VMAHan
             for (auto& area : iter->second.phys_areas) {
                 prev_vma->second.phys_areas[base_offset + area.first] = area.second;
             }
+            if (prev_vma->second.IsFree()) {
+                free_ranges.Erase(iter->second.base);
+                free_ranges.Resize(prev_vma->second.base, prev_vma->second.size);
+            }
             handle_map.erase(iter);
             iter = prev_vma;
         }
@@ -1543,6 +1535,10 @@ MemoryManager::VMAHandle MemoryManager::Split(VMAHandle vma_handle, u64 offset_i
         old_vma.phys_areas = old_vma_phys_areas;
     }
 
+    if (new_vma.IsFree()) {
+        free_ranges.Resize(old_vma.base, old_vma.size);
+        free_ranges.Insert(new_vma.base, new_vma.size);
+    }
     return vma_map.emplace_hint(std::next(vma_handle), new_vma.base, new_vma);
 }
 
@@ -8,10 +8,11 @@
 #include <string>
 #include <string_view>
 #include "common/enum.h"
-#include "common/shared_first_mutex.h"
+#include "common/sharded_shared_mutex.h"
 #include "common/singleton.h"
 #include "common/types.h"
 #include "core/address_space.h"
+#include "core/free_range_index.h"
 #include "core/libraries/kernel/memory.h"
 
 namespace Vulkan {
@@ -311,6 +312,8 @@ private:
 
     VAddr SearchFree(VAddr virtual_addr, u64 size, u32 alignment);
 
+    void SetVMAType(VirtualMemoryArea& vma, VMAType type);
+
     VMAHandle MergeAdjacent(VMAMap& map, VMAHandle iter);
 
     PhysHandle MergeAdjacent(PhysMap& map, PhysHandle iter);
@@ -332,7 +335,8 @@ private:
     PhysMap dmem_map;
     PhysMap fmem_map;
     VMAMap vma_map;
-    Common::SharedFirstMutex mutex{};
+    FreeRangeIndex free_ranges; ///< Mirrors the free VMAs of vma_map
+    Common::ShardedSharedMutex mutex{};
     std::mutex unmap_mutex{};
     u64 total_direct_size{};
     u64 total_flexible_size{};
@@ -83,8 +83,7 @@ static std::string StringToNid(std::string_view symbol) {
 }
 
 Module::Module(Core::MemoryManager* memory_, const std::filesystem::path& file_, u32& max_tls_index)
-    : memory{memory_}, file{file_}, name{file.filename().string()} {
-    elf.Open(file);
+    : Module(memory_, file_) {
     if (elf.IsElfFile()) {
         LoadModuleToMemory(max_tls_index);
         LoadDynamicInfo();
@@ -92,6 +91,11 @@ Module::Module(Core::MemoryManager* memory_, const std::filesystem::path& file_,
     }
 }
 
+Module::Module(Core::MemoryManager* memory_, const std::filesystem::path& file_)
+    : memory{memory_}, file{file_}, name{file.filename().string()} {
+    elf.Open(file);
+}
+
 Module::~Module() = default;
 
 s32 Module::Start(u64 args, const void* argp, void* param) {
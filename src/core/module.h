@@ -143,6 +143,9 @@ class Module {
 public:
     explicit Module(Core::MemoryManager* memory, const std::filesystem::path& file,
                     u32& max_tls_index);
+    /// Only opens the ELF file. Loading is finished by LoadModuleToMemory, which must run in
+    /// module order, followed by LoadDynamicInfo and LoadSymbols.
+    explicit Module(Core::MemoryManager* memory, const std::filesystem::path& file);
     ~Module();
 
     VAddr GetBaseAddress() const noexcept {
@@ -161,6 +164,10 @@ public:
         return base_virtual_addr != 0;
     }
 
+    bool IsElfFile() const {
+        return elf.IsElfFile();
+    }
+
     bool IsSharedLib() const noexcept {
         return elf.IsSharedLib();
     }
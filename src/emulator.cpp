@@ -412,12 +412,14 @@ void Emulator::Run(std::filesystem::path file, std::vector<std::string> args,
     LoadSystemModules(game_info.game_serial);
 
     // Load all prx from game's sce_module folder
-    mnt->IterateDirectory("/app0/sce_module", [this](const auto& path, const auto is_file) {
+    std::vector<std::filesystem::path> game_modules;
+    mnt->IterateDirectory("/app0/sce_module", [&](const auto& path, const auto is_file) {
         if (is_file) {
             LOG_INFO(Loader, "Loading {}", fmt::UTF(path.u8string()));
-            linker->LoadModule(path);
+            game_modules.push_back(path);
         }
     });
+    linker->LoadModules(game_modules);
 
 #ifdef ENABLE_DISCORD_RPC
     // Discord RPC
@@ -581,20 +583,17 @@ void Emulator::LoadSystemModules(const std::string& game_serial) {
     for (const auto& entry : std::filesystem::directory_iterator(sys_module_path)) {
         found_modules.push_back(entry.path());
     }
-    for (const auto& [module_name, init_func] : ModulesToLoad) {
-        const auto it = std::ranges::find_if(
-            found_modules, [&](const auto& path) { return path.filename() == module_name; });
+    // Modules are loaded in one batch, the ones that fail fall back to HLE afterwards.
+    std::vector<std::filesystem::path> modules_to_load;
+    std::vector<size_t> module_indices;
+    for (size_t i = 0; i < ModulesToLoad.size(); ++i) {
+        const auto it = std::ranges::find_if(found_modules, [&](const auto& path) {
+            return path.filename() == ModulesToLoad[i].module_name;
+        });
         if (it != found_modules.end()) {
             LOG_INFO(Loader, "Loading {}", it->string());
-            if (linker->LoadModule(*it) != -1) {
-                continue;
-            }
-        }
-        if (init_func) {
-            LOG_INFO(Loader, "Can't Load {} switching to HLE", module_name);
-            init_func(&linker->GetHLESymbols());
-        } else {
-            LOG_INFO(Loader, "No HLE available for {} module", module_name);
+            modules_to_load.push_back(*it);
+            module_indices.push_back(i);
         }
     }
     if (!game_serial.empty() && std::filesystem::exists(sys_module_path / game_serial)) {
@@ -602,7 +601,22 @@ void Emulator::LoadSystemModules(const std::string& game_serial) {
              std::filesystem::directory_iterator(sys_module_path / game_serial)) {
             LOG_INFO(Loader, "Loading {} from game serial file {}", entry.path().string(),
                      game_serial);
-            linker->LoadModule(entry.path());
+            modules_to_load.push_back(entry.path());
+        }
+    }
+    const auto handles = linker->LoadModules(modules_to_load);
+
+    for (size_t i = 0; i < ModulesToLoad.size(); ++i) {
+        const auto it = std::ranges::find(module_indices, i);
+        if (it != module_indices.end() && handles[it - module_indices.begin()] != -1) {
+            continue;
+        }
+        const auto& [module_name, init_func] = ModulesToLoad[i];
+        if (init_func) {
+            LOG_INFO(Loader, "Can't Load {} switching to HLE", module_name);
+            init_func(&linker->GetHLESymbols());
+        } else {
+            LOG_INFO(Loader, "No HLE available for {} module", module_name);
         }
     }
 }
@@ -11,6 +11,7 @@
 
 #include <core/emulator_state.h>
 #include "common/config.h"
+#include "common/io_file_bench.h"
 #include "common/key_manager.h"
 #include "common/logging/backend.h"
 #include "common/memory_patcher.h"
@@ -18,7 +19,9 @@
 #include "core/debugger.h"
 #include "core/file_sys/fs.h"
 #include "core/ipc/ipc.h"
+#include "core/libraries/audio/audio_convert_bench.h"
 #include "emulator.h"
+#include "shader_recompiler/offline_compiler.h"
 
 #ifdef _WIN32
 #include <windows.h>
@@ -70,6 +73,10 @@ int main(int argc, char* argv[]) {
     std::optional<std::filesystem::path> addGameFolder;
     std::optional<std::filesystem::path> setAddonFolder;
     std::optional<std::string> patchFile;
+    std::optional<std::filesystem::path> recompileShaders;
+    u32 numJobs = 0;
+    std::optional<u32> benchAudioConvert;
+    std::optional<std::filesystem::path> benchFileReads;
 
     // ---- Options ----
     app.add_option("-g,--game", gamePath, "Game path or ID");
@@ -93,6 +100,18 @@ int main(int argc, char* argv[]) {
     app.add_option("--add-game-folder", addGameFolder)->check(CLI::ExistingDirectory);
     app.add_option("--set-addon-folder", setAddonFolder)->check(CLI::ExistingDirectory);
 
+    app.add_option("--recompile-shaders", recompileShaders,
+                   "Recompile the shader captures in a directory and print timings")
+        ->check(CLI::ExistingDirectory);
+    app.add_option("--jobs", numJobs,
+                   "Worker threads for --recompile-shaders and --bench-file-reads");
+    app.add_option("--bench-audio-convert", benchAudioConvert,
+                   "Time the audio output conversion on buffers of N frames")
+        ->check(CLI::PositiveNumber);
+    app.add_option("--bench-file-reads", benchFileReads,
+                   "Time concurrent positional reads of a scratch file created in a directory")
+        ->check(CLI::ExistingDirectory);
+
     // ---- Capture args after `--` verbatim ----
     app.allow_extras();
     app.parse_complete_callback([&]() {
@@ -133,6 +152,20 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
+    if (recompileShaders) {
+        Common::Log::Initialize("shader_recompile.log");
+        Common::Log::Start();
+        return Shader::RecompileCaptures(*recompileShaders, numJobs);
+    }
+
+    if (benchAudioConvert) {
+        return Libraries::AudioOut::BenchmarkAudioConvert(*benchAudioConvert);
+    }
+
+    if (benchFileReads) {
+        return Common::FS::BenchmarkFileReads(*benchFileReads, numJobs);
+    }
+
     if (!gamePath.has_value()) {
         if (!gameArgs.empty()) {
             gamePath = gameArgs.front();
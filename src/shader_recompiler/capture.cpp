@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "common/io_file.h"
+#include "common/logging/log.h"
+#include "common/serdes.h"
+#include "shader_recompiler/capture.h"
+#include "shader_recompiler/frontend/fetch_shader.h"
+#include "shader_recompiler/info.h"
+
+namespace Shader {
+
+std::optional<ShaderCapture> ShaderCapture::Create(const Info& info, std::span<const u32> code,
+                                                   const RuntimeInfo& runtime_info,
+                                                   const Profile& profile,
+                                                   const Backend::Bindings& binding,
+                                                   u64 perm_idx) {
+    ShaderCapture capture{
+        .stage = info.stage,
+        .l_stage = info.l_stage,
+        .pgm_hash = info.pgm_hash,
+        .perm_idx = perm_idx,
+        .profile = profile,
+        .runtime_info = runtime_info,
+        .binding = binding,
+        .code{code.begin(), code.end()},
+        .user_data{info.user_data.begin(), info.user_data.end()},
+        .flattened_ud_buf = info.flattened_ud_buf,
+    };
+
+    if (info.stage == Stage::Vertex || info.stage == Stage::Export ||
+        info.stage == Stage::Local) {
+        if (!profile.supports_robust_buffer_access) {
+            // The fetch shader is inlined and its location is not tracked by the info.
+            LOG_WARNING(Render_Recompiler, "Unable to capture {} shader {:#x} with inlined fetch",
+                        info.stage, info.pgm_hash);
+            return std::nullopt;
+        }
+        if (const auto fetch_data = Gcn::ParseFetchShader(info)) {
+            const u32* fetch_code = Gcn::GetFetchShaderCode(info, info.fetch_shader_sgpr_base);
+            capture.fetch_shader_sgpr_base = info.fetch_shader_sgpr_base;
+            capture.fetch_shader_code.assign(fetch_code,
+                                             fetch_code + fetch_data->size / sizeof(u32));
+        }
+    }
+    return capture;
+}
+
+std::optional<ShaderCapture> ShaderCapture::Load(const std::filesystem::path& path) {
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read};
+    if (!file.IsOpen()) {
+        return std::nullopt;
+    }
+    std::vector<u8> data(file.GetSize());
+    if (data.size() < sizeof(u32) || file.Read(data) != data.size()) {
+        return std::nullopt;
+    }
+
+    Serialization::Archive ar{std::move(data)};
+    Serialization::Reader reader{ar};
+
+    u32 version{};
+    reader.Read(version);
+    if (version != Version) {
+        return std::nullopt;
+    }
+
+    ShaderCapture capture{};
+    reader.Read(capture.stage);
+    reader.Read(capture.l_stage);
+    reader.Read(capture.pgm_hash);
+    reader.Read(capture.perm_idx);
+    reader.Read(capture.profile);
+    reader.Read(capture.runtime_info);
+    reader.Read(capture.binding);
+    reader.Read(capture.code);
+    reader.Read(capture.user_data);
+    reader.Read(capture.flattened_ud_buf);
+    reader.Read(capture.fetch_shader_sgpr_base);
+    reader.Read(capture.fetch_shader_code);
+    if (capture.code.empty() || capture.user_data.size() != ShaderParams::NumShaderUserData) {
+        return std::nullopt;
+    }
+    return capture;
+}
+
+void ShaderCapture::Save(const std::filesystem::path& path) const {
+    Serialization::Archive ar;
+    Serialization::Writer writer{ar};
+
+    writer.Write(Version);
+    writer.Write(stage);
+    writer.Write(l_stage);
+    writer.Write(pgm_hash);
+    writer.Write(perm_idx);
+    writer.Write(profile);
+    writer.Write(runtime_info);
+    writer.Write(binding);
+    writer.Write(code);
+    writer.Write(user_data);
+    writer.Write(flattened_ud_buf);
+    writer.Write(fetch_shader_sgpr_base);
+    writer.Write(fetch_shader_code);
+
+    const auto data = ar.TakeOff();
+    const auto file = Common::FS::IOFile{path, Common::FS::FileAccessMode::Create};
+    file.WriteSpan(std::span<const u8>{data});
+}
+
+std::vector<u32> ShaderCapture::PatchedUserData() const {
+    std::vector<u32> patched = user_data;
+    if (!fetch_shader_code.empty()) {
+        const u32* fetch_code = fetch_shader_code.data();
+        std::memcpy(&patched[fetch_shader_sgpr_base], &fetch_code, sizeof(fetch_code));
+    }
+    return patched;
+}
+
+} // namespace Shader
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "common/types.h"
+#include "shader_recompiler/backend/bindings.h"
+#include "shader_recompiler/params.h"
+#include "shader_recompiler/profile.h"
+#include "shader_recompiler/runtime_info.h"
+
+namespace Shader {
+
+struct Info;
+
+/**
+ * Everything the recompiler reads while translating a guest shader, captured when shader
+ * dumping is enabled so the shader can be recompiled offline without the game or a GPU.
+ */
+struct ShaderCapture {
+    static constexpr u32 Version = 1;
+    static constexpr std::string_view Extension = "capture";
+
+    Stage stage{};
+    LogicalStage l_stage{};
+    u64 pgm_hash{};
+    u64 perm_idx{};
+    Profile profile{};
+    RuntimeInfo runtime_info{};
+    Backend::Bindings binding{};
+    std::vector<u32> code;
+    std::vector<u32> user_data;
+    std::vector<u32> flattened_ud_buf;
+    u32 fetch_shader_sgpr_base{};
+    std::vector<u32> fetch_shader_code;
+
+    /// Captures the inputs of a shader that has just been translated.
+    static std::optional<ShaderCapture> Create(const Info& info, std::span<const u32> code,
+                                               const RuntimeInfo& runtime_info,
+                                               const Profile& profile,
+                                               const Backend::Bindings& binding, u64 perm_idx);
+
+    /// Loads a capture from a file, returns nullopt if it is invalid or outdated.
+    static std::optional<ShaderCapture> Load(const std::filesystem::path& path);
+
+    /// Writes the capture to a file.
+    void Save(const std::filesystem::path& path) const;
+
+    /// Returns the user data registers with the fetch shader address pointing to the capture.
+    std::vector<u32> PatchedUserData() const;
+};
+
+} // namespace Shader
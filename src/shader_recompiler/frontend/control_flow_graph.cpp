@@ -102,8 +102,8 @@ static std::optional<u32> ResolveSetPcTarget(std::span<const GcnInst> list, u32
 
 static constexpr size_t LabelReserveSize = 32;
 
-CFG::CFG(Common::ObjectPool<Block>& block_pool_, std::span<const GcnInst> inst_list_)
-    : block_pool{block_pool_}, inst_list{inst_list_} {
+CFG::CFG(Common::Arena& arena_, std::span<const GcnInst> inst_list_)
+    : arena{arena_}, inst_list{inst_list_} {
     index_to_pc.resize(inst_list.size() + 1);
     labels.reserve(LabelReserveSize);
     EmitLabels();
@@ -210,7 +210,7 @@ void CFG::SplitDivergenceScopes() {
                     }
 
                     // Create a new block for the divergence scope.
-                    Block* block = block_pool.Create();
+                    Block* block = arena.Create<Block>();
                     block->begin = index_to_pc[curr_begin];
                     block->end = index_to_pc[curr_end];
                     block->begin_index = curr_begin;
@@ -220,7 +220,7 @@ void CFG::SplitDivergenceScopes() {
 
                     // If we are inside the parent block, make an epilogue block and jump to it.
                     if (curr_end != blk->end_index) {
-                        Block* epi_block = block_pool.Create();
+                        Block* epi_block = arena.Create<Block>();
                         epi_block->begin = index_to_pc[curr_end + 1];
                         epi_block->end = blk->end;
                         epi_block->begin_index = curr_end + 1;
@@ -292,7 +292,7 @@ void CFG::EmitBlocks() {
 
         // Insert block between the labels using the last instruction
         // as an indicator for branching type.
-        Block* block = block_pool.Create();
+        Block* block = arena.Create<Block>();
         block->begin = start;
         block->end = end;
         block->begin_index = GetIndex(start);
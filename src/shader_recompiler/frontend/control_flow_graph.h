@@ -9,8 +9,8 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/intrusive/set.hpp>
 
+#include "common/arena.h"
 #include "common/assert.h"
-#include "common/object_pool.h"
 #include "common/types.h"
 #include "shader_recompiler/frontend/instruction.h"
 #include "shader_recompiler/ir/condition.h"
@@ -49,7 +49,7 @@ class CFG {
     using Label = u32;
 
 public:
-    explicit CFG(Common::ObjectPool<Block>& block_pool, std::span<const GcnInst> inst_list);
+    explicit CFG(Common::Arena& arena, std::span<const GcnInst> inst_list);
 
     [[nodiscard]] std::string Dot() const;
 
@@ -76,7 +76,7 @@ private:
     };
 
 public:
-    Common::ObjectPool<Block>& block_pool;
+    Common::Arena& arena;
     std::span<const GcnInst> inst_list;
     std::vector<u32> index_to_pc;
     boost::container::small_vector<Label, 16> labels;
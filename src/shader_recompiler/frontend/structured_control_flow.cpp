@@ -283,7 +283,7 @@ bool NeedsLift(Node goto_stmt, Node label_stmt) noexcept {
  */
 class GotoPass {
 public:
-    explicit GotoPass(CFG& cfg, Common::ObjectPool<Statement>& stmt_pool) : pool{stmt_pool} {
+    explicit GotoPass(CFG& cfg, Common::Arena& arena_) : arena{arena_} {
         std::vector gotos{BuildTree(cfg)};
         const auto end{gotos.rend()};
         for (auto goto_stmt = gotos.rbegin(); goto_stmt != end; ++goto_stmt) {
@@ -355,13 +355,13 @@ private:
 
     void BuildTree(CFG& cfg, u32& label_id, std::vector<Node>& gotos, Node function_insert_point,
                    std::optional<Node> return_label) {
-        Statement* const false_stmt{pool.Create(Identity{}, IR::Condition::False, &root_stmt)};
+        Statement* const false_stmt{NewStatement(Identity{}, IR::Condition::False, &root_stmt)};
         Tree& root{root_stmt.children};
         std::unordered_map<Block*, Node> local_labels;
         local_labels.reserve(cfg.blocks.size());
 
         for (Block& block : cfg.blocks) {
-            Statement* const label{pool.Create(Label{}, label_id, &root_stmt)};
+            Statement* const label{NewStatement(Label{}, label_id, &root_stmt)};
             const Node label_it{root.insert(function_insert_point, *label)};
             local_labels.emplace(&block, label_it);
             ++label_id;
@@ -373,37 +373,37 @@ private:
 
             // Reset goto variables before the first block and after its respective label
             const auto make_reset_variable{[&]() -> Statement& {
-                return *pool.Create(SetVariable{}, label->id, false_stmt, &root_stmt);
+                return *NewStatement(SetVariable{}, label->id, false_stmt, &root_stmt);
             }};
             root.push_front(make_reset_variable());
             root.insert(ip, make_reset_variable());
-            root.insert(ip, *pool.Create(&block, &root_stmt));
+            root.insert(ip, *NewStatement(&block, &root_stmt));
 
             switch (block.end_class) {
             case EndClass::Branch: {
                 Statement* const always_cond{
-                    pool.Create(Identity{}, IR::Condition::True, &root_stmt)};
+                    NewStatement(Identity{}, IR::Condition::True, &root_stmt)};
                 if (block.cond == IR::Condition::True) {
                     const Node true_label{local_labels.at(block.branch_true)};
-                    gotos.push_back(
-                        root.insert(ip, *pool.Create(Goto{}, always_cond, true_label, &root_stmt)));
+                    gotos.push_back(root.insert(
+                        ip, *NewStatement(Goto{}, always_cond, true_label, &root_stmt)));
                 } else if (block.cond == IR::Condition::False) {
                     const Node false_label{local_labels.at(block.branch_false)};
                     gotos.push_back(root.insert(
-                        ip, *pool.Create(Goto{}, always_cond, false_label, &root_stmt)));
+                        ip, *NewStatement(Goto{}, always_cond, false_label, &root_stmt)));
                 } else {
                     const Node true_label{local_labels.at(block.branch_true)};
                     const Node false_label{local_labels.at(block.branch_false)};
-                    Statement* const true_cond{pool.Create(Identity{}, block.cond, &root_stmt)};
+                    Statement* const true_cond{NewStatement(Identity{}, block.cond, &root_stmt)};
                     gotos.push_back(
-                        root.insert(ip, *pool.Create(Goto{}, true_cond, true_label, &root_stmt)));
+                        root.insert(ip, *NewStatement(Goto{}, true_cond, true_label, &root_stmt)));
                     gotos.push_back(root.insert(
-                        ip, *pool.Create(Goto{}, always_cond, false_label, &root_stmt)));
+                        ip, *NewStatement(Goto{}, always_cond, false_label, &root_stmt)));
                 }
                 break;
             }
             case EndClass::Exit:
-                root.insert(ip, *pool.Create(Return{}, &root_stmt));
+                root.insert(ip, *NewStatement(Return{}, &root_stmt));
                 break;
             }
         }
@@ -419,8 +419,8 @@ private:
         Tree& body{goto_stmt->up->children};
         Tree if_body;
         if_body.splice(if_body.begin(), body, std::next(goto_stmt), label_stmt);
-        Statement* const cond{pool.Create(Not{}, goto_stmt->cond, &root_stmt)};
-        Statement* const if_stmt{pool.Create(If{}, cond, std::move(if_body), goto_stmt->up)};
+        Statement* const cond{NewStatement(Not{}, goto_stmt->cond, &root_stmt)};
+        Statement* const if_stmt{NewStatement(If{}, cond, std::move(if_body), goto_stmt->up)};
         UpdateTreeUp(if_stmt);
         body.insert(goto_stmt, *if_stmt);
         body.erase(goto_stmt);
@@ -431,7 +431,7 @@ private:
         Tree loop_body;
         loop_body.splice(loop_body.begin(), body, label_stmt, goto_stmt);
         Statement* const cond{goto_stmt->cond};
-        Statement* const loop{pool.Create(Loop{}, cond, std::move(loop_body), goto_stmt->up)};
+        Statement* const loop{NewStatement(Loop{}, cond, std::move(loop_body), goto_stmt->up)};
         UpdateTreeUp(loop);
         body.insert(goto_stmt, *loop);
         body.erase(goto_stmt);
@@ -456,15 +456,15 @@ private:
         const u32 label_id{label->id};
 
         Statement* const goto_cond{goto_stmt->cond};
-        Statement* const set_var{pool.Create(SetVariable{}, label_id, goto_cond, parent)};
+        Statement* const set_var{NewStatement(SetVariable{}, label_id, goto_cond, parent)};
         body.insert(goto_stmt, *set_var);
 
         Tree if_body;
         if_body.splice(if_body.begin(), body, std::next(goto_stmt), label_nested_stmt);
-        Statement* const variable{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const neg_var{pool.Create(Not{}, variable, &root_stmt)};
+        Statement* const variable{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const neg_var{NewStatement(Not{}, variable, &root_stmt)};
         if (!if_body.empty()) {
-            Statement* const if_stmt{pool.Create(If{}, neg_var, std::move(if_body), parent)};
+            Statement* const if_stmt{NewStatement(If{}, neg_var, std::move(if_body), parent)};
             UpdateTreeUp(if_stmt);
             body.insert(goto_stmt, *if_stmt);
         }
@@ -474,7 +474,7 @@ private:
         case StatementType::If:
             // Update nested if condition
             label_nested_stmt->cond =
-                pool.Create(Or{}, variable, label_nested_stmt->cond, &root_stmt);
+                NewStatement(Or{}, variable, label_nested_stmt->cond, &root_stmt);
             break;
         case StatementType::Loop:
             break;
@@ -482,7 +482,7 @@ private:
             UNREACHABLE_MSG("Invalid inward movement");
         }
         Tree& nested_tree{label_nested_stmt->children};
-        Statement* const new_goto{pool.Create(Goto{}, variable, label, &*label_nested_stmt)};
+        Statement* const new_goto{NewStatement(Goto{}, variable, label, &*label_nested_stmt)};
         return nested_tree.insert(nested_tree.begin(), *new_goto);
     }
 
@@ -496,16 +496,16 @@ private:
         Tree loop_body;
         loop_body.splice(loop_body.begin(), body, label_nested_stmt, goto_stmt);
         SanitizeNoBreaks(loop_body);
-        Statement* const variable{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const loop_stmt{pool.Create(Loop{}, variable, std::move(loop_body), parent)};
+        Statement* const variable{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const loop_stmt{NewStatement(Loop{}, variable, std::move(loop_body), parent)};
         UpdateTreeUp(loop_stmt);
         body.insert(goto_stmt, *loop_stmt);
 
-        Statement* const new_goto{pool.Create(Goto{}, variable, label, loop_stmt)};
+        Statement* const new_goto{NewStatement(Goto{}, variable, label, loop_stmt)};
         loop_stmt->children.push_front(*new_goto);
         const Node new_goto_node{loop_stmt->children.begin()};
 
-        Statement* const set_var{pool.Create(SetVariable{}, label_id, goto_stmt->cond, loop_stmt)};
+        Statement* const set_var{NewStatement(SetVariable{}, label_id, goto_stmt->cond, loop_stmt)};
         loop_stmt->children.push_back(*set_var);
 
         body.erase(goto_stmt);
@@ -517,22 +517,22 @@ private:
         Tree& body{parent->children};
         const u32 label_id{goto_stmt->label->id};
         Statement* const goto_cond{goto_stmt->cond};
-        Statement* const set_goto_var{pool.Create(SetVariable{}, label_id, goto_cond, &*parent)};
+        Statement* const set_goto_var{NewStatement(SetVariable{}, label_id, goto_cond, &*parent)};
         body.insert(goto_stmt, *set_goto_var);
 
         Tree if_body;
         if_body.splice(if_body.begin(), body, std::next(goto_stmt), body.end());
         if_body.pop_front();
-        Statement* const cond{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const neg_cond{pool.Create(Not{}, cond, &root_stmt)};
-        Statement* const if_stmt{pool.Create(If{}, neg_cond, std::move(if_body), &*parent)};
+        Statement* const cond{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const neg_cond{NewStatement(Not{}, cond, &root_stmt)};
+        Statement* const if_stmt{NewStatement(If{}, neg_cond, std::move(if_body), &*parent)};
         UpdateTreeUp(if_stmt);
         body.insert(goto_stmt, *if_stmt);
 
         body.erase(goto_stmt);
 
-        Statement* const new_cond{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const new_goto{pool.Create(Goto{}, new_cond, goto_stmt->label, parent->up)};
+        Statement* const new_cond{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const new_goto{NewStatement(Goto{}, new_cond, goto_stmt->label, parent->up)};
         Tree& parent_tree{parent->up->children};
         return parent_tree.insert(std::next(parent), *new_goto);
     }
@@ -542,21 +542,26 @@ private:
         Tree& body{parent->children};
         const u32 label_id{goto_stmt->label->id};
         Statement* const goto_cond{goto_stmt->cond};
-        Statement* const set_goto_var{pool.Create(SetVariable{}, label_id, goto_cond, parent)};
-        Statement* const cond{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const break_stmt{pool.Create(Break{}, cond, parent)};
+        Statement* const set_goto_var{NewStatement(SetVariable{}, label_id, goto_cond, parent)};
+        Statement* const cond{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const break_stmt{NewStatement(Break{}, cond, parent)};
         body.insert(goto_stmt, *set_goto_var);
         body.insert(goto_stmt, *break_stmt);
         body.erase(goto_stmt);
 
         const Node loop{Tree::s_iterator_to(*goto_stmt->up)};
-        Statement* const new_goto_cond{pool.Create(Variable{}, label_id, &root_stmt)};
-        Statement* const new_goto{pool.Create(Goto{}, new_goto_cond, goto_stmt->label, loop->up)};
+        Statement* const new_goto_cond{NewStatement(Variable{}, label_id, &root_stmt)};
+        Statement* const new_goto{NewStatement(Goto{}, new_goto_cond, goto_stmt->label, loop->up)};
         Tree& parent_tree{loop->up->children};
         return parent_tree.insert(std::next(loop), *new_goto);
     }
 
-    Common::ObjectPool<Statement>& pool;
+    template <typename... Args>
+    Statement* NewStatement(Args&&... args) const {
+        return arena.Create<Statement>(std::forward<Args>(args)...);
+    }
+
+    Common::Arena& arena;
     Statement root_stmt{FunctionTag{}};
 };
 
@@ -590,14 +595,12 @@ private:
 
 class TranslatePass {
 public:
-    TranslatePass(Common::ObjectPool<IR::Inst>& inst_pool_,
-                  Common::ObjectPool<IR::Block>& block_pool_,
-                  Common::ObjectPool<Statement>& stmt_pool_, Statement& root_stmt,
+    TranslatePass(Common::Arena& arena_, Statement& root_stmt,
                   IR::AbstractSyntaxList& syntax_list_, std::span<const GcnInst> inst_list_,
                   Info& info_, const RuntimeInfo& runtime_info_, const Profile& profile_)
-        : stmt_pool{stmt_pool_}, inst_pool{inst_pool_}, block_pool{block_pool_},
-          syntax_list{syntax_list_}, inst_list{inst_list_}, runtime_info{runtime_info_},
-          profile{profile_}, translator{info_, runtime_info_, profile_} {
+        : arena{arena_}, syntax_list{syntax_list_}, inst_list{inst_list_},
+          runtime_info{runtime_info_}, profile{profile_},
+          translator{info_, runtime_info_, profile_} {
         Visit(root_stmt, nullptr, nullptr);
 
         IR::Block* first_block = syntax_list.front().data.block;
@@ -611,7 +614,7 @@ private:
             if (current_block) {
                 return;
             }
-            current_block = block_pool.Create(inst_pool);
+            current_block = arena.Create<IR::Block>(arena);
             auto& node{syntax_list.emplace_back()};
             node.type = IR::AbstractSyntaxNode::Type::Block;
             node.data.block = current_block;
@@ -676,7 +679,7 @@ private:
                 break;
             }
             case StatementType::Loop: {
-                IR::Block* const loop_header_block{block_pool.Create(inst_pool)};
+                IR::Block* const loop_header_block{arena.Create<IR::Block>(arena)};
                 if (current_block) {
                     current_block->AddBranch(loop_header_block);
                 }
@@ -684,7 +687,7 @@ private:
                 header_node.type = IR::AbstractSyntaxNode::Type::Block;
                 header_node.data.block = loop_header_block;
 
-                IR::Block* const continue_block{block_pool.Create(inst_pool)};
+                IR::Block* const continue_block{arena.Create<IR::Block>(arena)};
                 IR::Block* const merge_block{MergeBlock(parent, stmt)};
 
                 const size_t loop_node_index{syntax_list.size()};
@@ -750,7 +753,7 @@ private:
             }
             case StatementType::Return: {
                 ensure_block();
-                IR::Block* return_block{block_pool.Create(inst_pool)};
+                IR::Block* return_block{arena.Create<IR::Block>(arena)};
                 IR::IREmitter{*return_block}.Epilogue();
                 current_block->AddBranch(return_block);
 
@@ -785,15 +788,18 @@ private:
         Statement* merge_stmt{TryFindForwardBlock(stmt)};
         if (!merge_stmt) {
             // Create a merge block we can visit later
-            merge_stmt = stmt_pool.Create(&dummy_flow_block, &parent);
+            merge_stmt = NewStatement(&dummy_flow_block, &parent);
             parent.children.insert(std::next(Tree::s_iterator_to(stmt)), *merge_stmt);
         }
-        return block_pool.Create(inst_pool);
+        return arena.Create<IR::Block>(arena);
+    }
+
+    template <typename... Args>
+    Statement* NewStatement(Args&&... args) const {
+        return arena.Create<Statement>(std::forward<Args>(args)...);
     }
 
-    Common::ObjectPool<Statement>& stmt_pool;
-    Common::ObjectPool<IR::Inst>& inst_pool;
-    Common::ObjectPool<IR::Block>& block_pool;
+    Common::Arena& arena;
     IR::AbstractSyntaxList& syntax_list;
     const Block dummy_flow_block{.is_dummy = true};
     std::span<const GcnInst> inst_list;
@@ -803,15 +809,12 @@ private:
 };
 } // Anonymous namespace
 
-IR::AbstractSyntaxList BuildASL(Common::ObjectPool<IR::Inst>& inst_pool,
-                                Common::ObjectPool<IR::Block>& block_pool, CFG& cfg, Info& info,
+IR::AbstractSyntaxList BuildASL(Common::Arena& arena, CFG& cfg, Info& info,
                                 const RuntimeInfo& runtime_info, const Profile& profile) {
-    Common::ObjectPool<Statement> stmt_pool{64};
-    GotoPass goto_pass{cfg, stmt_pool};
+    GotoPass goto_pass{cfg, arena};
     Statement& root{goto_pass.RootStatement()};
     IR::AbstractSyntaxList syntax_list;
-    TranslatePass{inst_pool,     block_pool, stmt_pool,    root,   syntax_list,
-                  cfg.inst_list, info,       runtime_info, profile};
+    TranslatePass{arena, root, syntax_list, cfg.inst_list, info, runtime_info, profile};
     ASSERT_MSG(!info.translation_failed, "Shader translation has failed");
     return syntax_list;
 }
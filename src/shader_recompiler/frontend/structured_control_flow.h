@@ -16,9 +16,8 @@ struct RuntimeInfo;
 
 namespace Shader::Gcn {
 
-[[nodiscard]] IR::AbstractSyntaxList BuildASL(Common::ObjectPool<IR::Inst>& inst_pool,
-                                              Common::ObjectPool<IR::Block>& block_pool, CFG& cfg,
-                                              Info& info, const RuntimeInfo& runtime_info,
+[[nodiscard]] IR::AbstractSyntaxList BuildASL(Common::Arena& arena, CFG& cfg, Info& info,
+                                              const RuntimeInfo& runtime_info,
                                               const Profile& profile);
 
 } // namespace Shader::Gcn
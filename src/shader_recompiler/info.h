@@ -118,6 +118,7 @@ struct Info : InfoPersistent {
 
     std::span<const u32> user_data;
     std::vector<u32> flattened_ud_buf;
+    std::span<const u32> captured_ud_buf; ///< Replaces the SRT walk when recompiling offline
     PersistentSrtInfo srt_info;
 
     AttributeFlags loads{};
@@ -189,6 +190,11 @@ struct Info : InfoPersistent {
     }
 
     void RefreshFlatBuf() {
+        if (!captured_ud_buf.empty()) {
+            ASSERT(captured_ud_buf.size() == srt_info.flattened_bufsize_dw);
+            flattened_ud_buf.assign(captured_ud_buf.begin(), captured_ud_buf.end());
+            return;
+        }
         flattened_ud_buf.resize(srt_info.flattened_bufsize_dw);
         ASSERT(user_data.size() <= NUM_USER_DATA_REGS);
         std::memcpy(flattened_ud_buf.data(), user_data.data(), user_data.size_bytes());
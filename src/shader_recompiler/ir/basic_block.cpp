@@ -9,7 +9,8 @@
 
 namespace Shader::IR {
 
-Block::Block(Common::ObjectPool<Inst>& inst_pool_) : inst_pool{&inst_pool_} {}
+Block::Block(Common::Arena& arena_)
+    : arena{&arena_}, imm_predecessors{arena_}, imm_successors{arena_} {}
 
 Block::~Block() = default;
 
@@ -18,14 +19,14 @@ void Block::AppendNewInst(Opcode op, std::initializer_list<Value> args) {
 }
 
 Block::iterator Block::PrependNewInst(iterator insertion_point, const Inst& base_inst) {
-    Inst* const inst{inst_pool->Create(base_inst)};
+    Inst* const inst{arena->Create<Inst>(base_inst)};
     inst->SetParent(this);
     return instructions.insert(insertion_point, *inst);
 }
 
 Block::iterator Block::PrependNewInst(iterator insertion_point, Opcode op,
                                       std::initializer_list<Value> args, u32 flags) {
-    Inst* const inst{inst_pool->Create(op, flags)};
+    Inst* const inst{arena->Create<Inst>(*arena, op, flags)};
     inst->SetParent(this);
     const auto result_it{instructions.insert(insertion_point, *inst)};
 
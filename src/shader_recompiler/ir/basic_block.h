@@ -9,7 +9,7 @@
 #include <vector>
 #include <boost/intrusive/list.hpp>
 
-#include "common/object_pool.h"
+#include "common/arena.h"
 #include "common/types.h"
 #include "shader_recompiler/ir/reg.h"
 #include "shader_recompiler/ir/value.h"
@@ -29,7 +29,7 @@ public:
     using reverse_iterator = InstructionList::reverse_iterator;
     using const_reverse_iterator = InstructionList::const_reverse_iterator;
 
-    explicit Block(Common::ObjectPool<Inst>& inst_pool_);
+    explicit Block(Common::Arena& arena_);
     ~Block();
 
     Block(const Block&) = delete;
@@ -159,16 +159,16 @@ public:
     const Shader::Gcn::Block* cfg_block{};
 
 private:
-    /// Memory pool for instruction list
-    Common::ObjectPool<Inst>* inst_pool;
+    /// Arena holding the instructions of this block
+    Common::Arena* arena;
 
     /// List of instructions in this block
     InstructionList instructions;
 
     /// Block immediate predecessors
-    std::vector<Block*> imm_predecessors;
+    std::vector<Block*, Common::ArenaAllocator<Block*>> imm_predecessors;
     /// Block immediate successors
-    std::vector<Block*> imm_successors;
+    std::vector<Block*, Common::ArenaAllocator<Block*>> imm_successors;
 
     /// Intrusively store if the block is sealed in the SSA pass.
     bool is_ssa_sealed{false};
@@ -10,15 +10,16 @@
 
 namespace Shader::IR {
 
-Inst::Inst(IR::Opcode op_, u32 flags_) noexcept : op{op_}, flags{flags_} {
+Inst::Inst(Common::Arena& arena, IR::Opcode op_, u32 flags_) noexcept
+    : op{op_}, flags{flags_}, uses{UseList::allocator_type{arena}} {
     if (op == Opcode::Phi) {
-        std::construct_at(&phi_args);
+        std::construct_at(&phi_args, PhiArgs::allocator_type{arena});
     } else {
         std::construct_at(&args);
     }
 }
 
-Inst::Inst(const Inst& base) : op{base.op}, flags{base.flags} {
+Inst::Inst(const Inst& base) : op{base.op}, flags{base.flags}, uses{base.uses.get_allocator()} {
     ASSERT_MSG(base.op != Opcode::Phi, "Copying phi node");
     std::construct_at(&args);
     const size_t num_args{base.NumArgs()};
@@ -12,6 +12,7 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/intrusive/list.hpp>
 
+#include "common/arena.h"
 #include "common/assert.h"
 #include "shader_recompiler/ir/attribute.h"
 #include "shader_recompiler/ir/opcodes.h"
@@ -122,8 +123,12 @@ struct Use {
 };
 
 class Inst : public boost::intrusive::list_base_hook<> {
+    using PhiArg = std::pair<Block*, Value>;
+    using PhiArgs = boost::container::small_vector<PhiArg, 2, Common::ArenaAllocator<PhiArg>>;
+    using UseList = boost::container::list<IR::Use, Common::ArenaAllocator<IR::Use>>;
+
 public:
-    explicit Inst(IR::Opcode op_, u32 flags_) noexcept;
+    explicit Inst(Common::Arena& arena, IR::Opcode op_, u32 flags_) noexcept;
     explicit Inst(const Inst& base);
     ~Inst();
 
@@ -244,13 +249,13 @@ private:
     IR::Block* parent{};
     union {
         NonTriviallyDummy dummy{};
-        boost::container::small_vector<std::pair<Block*, Value>, 2> phi_args;
+        PhiArgs phi_args;
         std::array<Value, 6> args;
     };
 
-    boost::container::list<IR::Use> uses;
+    UseList uses;
 };
-static_assert(sizeof(Inst) <= 160, "Inst size unintentionally increased");
+static_assert(sizeof(Inst) <= 168, "Inst size unintentionally increased");
 
 using U1 = TypedValue<Type::U1>;
 using U8 = TypedValue<Type::U8>;
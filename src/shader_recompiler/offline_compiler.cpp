@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ranges>
+#include <thread>
+#include <vector>
+#include <fmt/format.h>
+
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/capture.h"
+#include "shader_recompiler/info.h"
+#include "shader_recompiler/offline_compiler.h"
+#include "shader_recompiler/recompiler.h"
+
+namespace Shader {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct CompileResult {
+    std::string name;
+    u64 time_ns;
+    size_t spirv_size;
+    std::vector<PassTiming> timings;
+};
+
+CompileResult Recompile(const ShaderCapture& capture, Pools& pools) {
+    const auto user_data = capture.PatchedUserData();
+    const ShaderParams params{
+        .user_data = std::span<const u32, ShaderParams::NumShaderUserData>{user_data},
+        .code = capture.code,
+        .hash = capture.pgm_hash,
+    };
+    Info info{capture.stage, capture.l_stage, params};
+    info.captured_ud_buf = capture.flattened_ud_buf;
+    RuntimeInfo runtime_info = capture.runtime_info;
+    Backend::Bindings binding = capture.binding;
+
+    CompileResult result{
+        .name = fmt::format("{}_{:#018x}_{}", capture.stage, capture.pgm_hash, capture.perm_idx),
+    };
+    const auto start = Clock::now();
+    const auto program =
+        TranslateProgram(capture.code, pools, info, runtime_info, capture.profile, &result.timings);
+    const auto emit_start = Clock::now();
+    const auto spv = Backend::SPIRV::EmitSPIRV(capture.profile, runtime_info, program, binding);
+    const auto end = Clock::now();
+
+    const u32 num_insts = result.timings.empty() ? 0 : result.timings.back().insts_after;
+    result.timings.push_back(PassTiming{
+        .name = "EmitSPIRV",
+        .time_ns = static_cast<u64>((end - emit_start) / std::chrono::nanoseconds{1}),
+        .insts_before = num_insts,
+        .insts_after = num_insts,
+        .num_blocks = static_cast<u32>(program.blocks.size()),
+    });
+    result.time_ns = (end - start) / std::chrono::nanoseconds{1};
+    result.spirv_size = spv.size() * sizeof(u32);
+    return result;
+}
+
+} // Anonymous namespace
+
+int RecompileCaptures(const std::filesystem::path& dir, u32 num_jobs) {
+    std::vector<ShaderCapture> captures;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator{dir, ec}) {
+        if (!entry.is_regular_file() ||
+            entry.path().extension() != fmt::format(".{}", ShaderCapture::Extension)) {
+            continue;
+        }
+        if (auto capture = ShaderCapture::Load(entry.path())) {
+            captures.emplace_back(std::move(*capture));
+        } else {
+            fmt::print("Skipping invalid or outdated capture {}\n", entry.path().string());
+        }
+    }
+    if (ec) {
+        fmt::print("Unable to read {}: {}\n", dir.string(), ec.message());
+        return 1;
+    }
+    if (captures.empty()) {
+        fmt::print("No shader captures found in {}\n", dir.string());
+        return 1;
+    }
+
+    if (num_jobs == 0) {
+        num_jobs = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    num_jobs = std::min<u32>(num_jobs, captures.size());
+
+    std::vector<CompileResult> results(captures.size());
+    std::atomic<size_t> next_capture{};
+    const auto worker = [&] {
+        Pools pools;
+        for (size_t i = next_capture++; i < captures.size(); i = next_capture++) {
+            results[i] = Recompile(captures[i], pools);
+        }
+    };
+
+    const auto start = Clock::now();
+    {
+        std::vector<std::jthread> workers;
+        for (u32 i = 1; i < num_jobs; ++i) {
+            workers.emplace_back([&worker, i] {
+                Common::SetCurrentThreadName(fmt::format("shadPS4:Recompiler{}", i).c_str());
+                worker();
+            });
+        }
+        worker();
+    }
+    const double wall_s = std::chrono::duration<double>(Clock::now() - start).count();
+
+    u64 total_ns{};
+    size_t total_spirv{};
+    PassProfile profile;
+    for (const auto& result : results) {
+        total_ns += result.time_ns;
+        total_spirv += result.spirv_size;
+        profile.Add(result.timings);
+    }
+
+    fmt::print("Recompiled {} shaders on {} threads in {:.3f} s ({:.1f} shaders/s)\n",
+               results.size(), num_jobs, wall_s, results.size() / wall_s);
+    fmt::print("Total SPIR-V size: {} bytes, average {} bytes\n", total_spirv,
+               total_spirv / results.size());
+
+    auto& passes = profile.entries;
+    std::ranges::sort(passes, std::greater{}, &PassProfile::Entry::time_ns);
+    fmt::print("\n{:<32} {:>12} {:>8} {:>12} {:>12}\n", "Pass", "Time (ms)", "Share",
+               "Max (us)", "IR delta");
+    for (const auto& pass : passes) {
+        fmt::print("{:<32} {:>12.3f} {:>7.1f}% {:>12.1f} {:>12}\n", pass.name,
+                   pass.time_ns / 1e6, 100.0 * pass.time_ns / total_ns, pass.max_time_ns / 1e3,
+                   pass.inst_delta);
+    }
+
+    constexpr size_t NumSlowest = 10;
+    std::ranges::sort(results, std::greater{}, &CompileResult::time_ns);
+    fmt::print("\n{:<40} {:>12} {:>12}\n", "Slowest shaders", "Time (ms)", "SPIR-V size");
+    for (const auto& result : results | std::views::take(NumSlowest)) {
+        fmt::print("{:<40} {:>12.3f} {:>12}\n", result.name, result.time_ns / 1e6,
+                   result.spirv_size);
+    }
+    return 0;
+}
+
+} // namespace Shader
@@ -0,0 +1,21 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+
+#include "common/types.h"
+
+namespace Shader {
+
+/**
+ * Recompiles every shader capture found in a directory on a pool of worker threads and prints
+ * the per-pass timings and SPIR-V sizes. Does not need a running game or a GPU.
+ * @param dir        Directory holding the .capture files written while dumping shaders.
+ * @param num_jobs   Number of worker threads, 0 to use all hardware threads.
+ * @returns Process exit code.
+ */
+int RecompileCaptures(const std::filesystem::path& dir, u32 num_jobs);
+
+} // namespace Shader
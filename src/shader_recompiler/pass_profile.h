@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "common/types.h"
+
+namespace Shader {
+
+/// Wall time spent in a single stage of the recompiler and its effect on the IR.
+struct PassTiming {
+    std::string_view name;
+    u64 time_ns;
+    u32 insts_before; ///< IR instructions, zero for the stages before BuildASL
+    u32 insts_after;
+    u32 num_blocks;
+};
+
+/// Per-stage totals of the pass timings of many shaders, in order of first appearance.
+struct PassProfile {
+    struct Entry {
+        std::string_view name;
+        u32 num_runs;
+        u64 time_ns;
+        u64 max_time_ns;
+        s64 inst_delta;
+    };
+
+    std::vector<Entry> entries;
+    u64 total_time_ns{};
+    u32 num_shaders{};
+
+    void Add(std::span<const PassTiming> timings) {
+        for (const auto& timing : timings) {
+            auto it = std::ranges::find(entries, timing.name, &Entry::name);
+            if (it == entries.end()) {
+                it = entries.insert(it, Entry{.name = timing.name});
+            }
+            ++it->num_runs;
+            it->time_ns += timing.time_ns;
+            it->max_time_ns = std::max(it->max_time_ns, timing.time_ns);
+            it->inst_delta += static_cast<s64>(timing.insts_after) - timing.insts_before;
+            total_time_ns += timing.time_ns;
+        }
+        ++num_shaders;
+    }
+};
+
+} // namespace Shader
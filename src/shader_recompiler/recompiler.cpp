@@ -1,6 +1,9 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
+#include <optional>
+
 #include "shader_recompiler/frontend/control_flow_graph.h"
 #include "shader_recompiler/frontend/decode.h"
 #include "shader_recompiler/frontend/structured_control_flow.h"
@@ -29,66 +32,102 @@ IR::BlockList GenerateBlocks(const IR::AbstractSyntaxList& syntax_list) {
 }
 
 IR::Program TranslateProgram(const std::span<const u32>& code, Pools& pools, Info& info,
-                             RuntimeInfo& runtime_info, const Profile& profile) {
+                             RuntimeInfo& runtime_info, const Profile& profile,
+                             std::vector<PassTiming>* timings) {
     // Ensure first instruction is expected.
     constexpr u32 token_mov_vcchi = 0xBEEB03FF;
     if (code[0] != token_mov_vcchi) {
         LOG_WARNING(Render_Recompiler, "First instruction is not s_mov_b32 vcc_hi, #imm");
     }
 
-    Gcn::GcnCodeSlice slice(code.data(), code.data() + code.size());
-    Gcn::GcnDecodeContext decoder;
+    IR::Program program{info};
+    const auto count_insts = [&program] {
+        u32 num_insts = 0;
+        for (const IR::Block* block : program.blocks) {
+            num_insts += static_cast<u32>(block->size());
+        }
+        return num_insts;
+    };
+    const auto run_pass = [&](std::string_view name, auto&& pass) {
+        if (!timings) {
+            pass();
+            return;
+        }
+        const u32 insts_before = count_insts();
+        const auto start = std::chrono::steady_clock::now();
+        pass();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        timings->push_back(PassTiming{
+            .name = name,
+            .time_ns = static_cast<u64>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+            .insts_before = insts_before,
+            .insts_after = count_insts(),
+            .num_blocks = static_cast<u32>(program.blocks.size()),
+        });
+    };
 
     // Decode and save instructions
-    IR::Program program{info};
-    program.ins_list.reserve(code.size());
-    while (!slice.atEnd()) {
-        program.ins_list.emplace_back(decoder.decodeInstruction(slice));
-    }
+    run_pass("Decode", [&] {
+        Gcn::GcnCodeSlice slice(code.data(), code.data() + code.size());
+        Gcn::GcnDecodeContext decoder;
+        program.ins_list.reserve(code.size());
+        while (!slice.atEnd()) {
+            program.ins_list.emplace_back(decoder.decodeInstruction(slice));
+        }
+    });
 
     // Clear any previous pooled data.
     pools.ReleaseContents();
 
     // Create control flow graph
-    Common::ObjectPool<Gcn::Block> gcn_block_pool{64};
-    Gcn::CFG cfg{gcn_block_pool, program.ins_list};
+    std::optional<Gcn::CFG> cfg;
+    run_pass("BuildCFG", [&] { cfg.emplace(pools.arena, program.ins_list); });
 
     // Structurize control flow graph and create program.
-    program.syntax_list =
-        Shader::Gcn::BuildASL(pools.inst_pool, pools.block_pool, cfg, info, runtime_info, profile);
-    program.blocks = GenerateBlocks(program.syntax_list);
-    program.post_order_blocks = Shader::IR::PostOrder(program.syntax_list.front());
+    run_pass("BuildASL", [&] {
+        program.syntax_list =
+            Shader::Gcn::BuildASL(pools.arena, *cfg, info, runtime_info, profile);
+        program.blocks = GenerateBlocks(program.syntax_list);
+        program.post_order_blocks = Shader::IR::PostOrder(program.syntax_list.front());
+    });
 
     // On NVIDIA GPUs HW interpolation of clip distance values seems broken, and we need to emulate
     // it with expensive discard in PS.
-    Shader::InjectClipDistanceAttributes(program, runtime_info);
+    run_pass("InjectClipDistanceAttributes",
+             [&] { Shader::InjectClipDistanceAttributes(program, runtime_info); });
 
     // Run optimization passes
+    using namespace Shader::Optimization;
     if (!profile.support_float64) {
-        Shader::Optimization::LowerFp64ToFp32(program);
+        run_pass("LowerFp64ToFp32", [&] { LowerFp64ToFp32(program); });
     }
-    Shader::Optimization::SsaRewritePass(program.post_order_blocks);
-    Shader::Optimization::ConstantPropagationPass(program.post_order_blocks);
-    Shader::Optimization::IdentityRemovalPass(program.blocks);
+    run_pass("SsaRewritePass", [&] { SsaRewritePass(program.post_order_blocks); });
+    run_pass("ConstantPropagationPass",
+             [&] { ConstantPropagationPass(program.post_order_blocks); });
+    run_pass("IdentityRemovalPass", [&] { IdentityRemovalPass(program.blocks); });
     if (info.l_stage == LogicalStage::TessellationControl) {
-        Shader::Optimization::TessellationPreprocess(program, runtime_info);
-        Shader::Optimization::HullShaderTransform(program, runtime_info);
+        run_pass("TessellationPreprocess", [&] { TessellationPreprocess(program, runtime_info); });
+        run_pass("HullShaderTransform", [&] { HullShaderTransform(program, runtime_info); });
     } else if (info.l_stage == LogicalStage::TessellationEval) {
-        Shader::Optimization::TessellationPreprocess(program, runtime_info);
-        Shader::Optimization::DomainShaderTransform(program, runtime_info);
+        run_pass("TessellationPreprocess", [&] { TessellationPreprocess(program, runtime_info); });
+        run_pass("DomainShaderTransform", [&] { DomainShaderTransform(program, runtime_info); });
     }
-    Shader::Optimization::RingAccessElimination(program, runtime_info);
-    Shader::Optimization::ReadLaneEliminationPass(program);
-    Shader::Optimization::FlattenExtendedUserdataPass(program);
-    Shader::Optimization::ResourceTrackingPass(program);
-    Shader::Optimization::LowerBufferFormatToRaw(program);
-    Shader::Optimization::SharedMemorySimplifyPass(program, profile);
-    Shader::Optimization::SharedMemoryToStoragePass(program, runtime_info, profile);
-    Shader::Optimization::SharedMemoryBarrierPass(program, runtime_info, profile);
-    Shader::Optimization::IdentityRemovalPass(program.blocks);
-    Shader::Optimization::DeadCodeEliminationPass(program);
-    Shader::Optimization::ConstantPropagationPass(program.post_order_blocks);
-    Shader::Optimization::CollectShaderInfoPass(program, profile);
+    run_pass("RingAccessElimination", [&] { RingAccessElimination(program, runtime_info); });
+    run_pass("ReadLaneEliminationPass", [&] { ReadLaneEliminationPass(program); });
+    run_pass("FlattenExtendedUserdataPass", [&] { FlattenExtendedUserdataPass(program); });
+    run_pass("ResourceTrackingPass", [&] { ResourceTrackingPass(program); });
+    run_pass("LowerBufferFormatToRaw", [&] { LowerBufferFormatToRaw(program); });
+    run_pass("SharedMemorySimplifyPass", [&] { SharedMemorySimplifyPass(program, profile); });
+    run_pass("SharedMemoryToStoragePass",
+             [&] { SharedMemoryToStoragePass(program, runtime_info, profile); });
+    run_pass("SharedMemoryBarrierPass",
+             [&] { SharedMemoryBarrierPass(program, runtime_info, profile); });
+    run_pass("IdentityRemovalPass", [&] { IdentityRemovalPass(program.blocks); });
+    run_pass("DeadCodeEliminationPass", [&] { DeadCodeEliminationPass(program); });
+    run_pass("ConstantPropagationPass",
+             [&] { ConstantPropagationPass(program.post_order_blocks); });
+    run_pass("CollectShaderInfoPass", [&] { CollectShaderInfoPass(program, profile); });
 
     Shader::IR::DumpProgram(program, info);
 
@@ -3,9 +3,12 @@
 
 #pragma once
 
-#include "common/object_pool.h"
+#include <vector>
+
+#include "common/arena.h"
 #include "shader_recompiler/ir/basic_block.h"
 #include "shader_recompiler/ir/program.h"
+#include "shader_recompiler/pass_profile.h"
 
 namespace Shader {
 
@@ -13,22 +16,21 @@ struct Profile;
 struct RuntimeInfo;
 
 struct Pools {
-    static constexpr u32 InstPoolSize = 8192;
-    static constexpr u32 BlockPoolSize = 32;
+    static constexpr size_t ArenaBlockSize = 4_MB;
 
-    Common::ObjectPool<IR::Inst> inst_pool;
-    Common::ObjectPool<IR::Block> block_pool;
+    /// Holds every IR instruction, block and frontend temporary of the program being compiled.
+    Common::Arena arena;
 
-    explicit Pools() : inst_pool{InstPoolSize}, block_pool{BlockPoolSize} {}
+    explicit Pools() : arena{ArenaBlockSize} {}
 
     void ReleaseContents() {
-        inst_pool.ReleaseContents();
-        block_pool.ReleaseContents();
+        arena.Reset();
     }
 };
 
 [[nodiscard]] IR::Program TranslateProgram(const std::span<const u32>& code, Pools& pools,
                                            Info& info, RuntimeInfo& runtime_info,
-                                           const Profile& profile);
+                                           const Profile& profile,
+                                           std::vector<PassTiming>* timings = nullptr);
 
 } // namespace Shader
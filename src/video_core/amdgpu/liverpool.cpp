@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
 #include <boost/preprocessor/stringize.hpp>
 
 #include "common/assert.h"
@@ -65,6 +67,19 @@ static std::span<const u32> NextPacket(std::span<const u32> span, size_t offset)
     return span.subspan(offset);
 }
 
+static u64 GetTimeNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void AtomicMax(std::atomic<u64>& value, u64 sample) {
+    u64 current = value.load(std::memory_order_relaxed);
+    while (current < sample &&
+           !value.compare_exchange_weak(current, sample, std::memory_order_relaxed)) {
+    }
+}
+
 Liverpool::Liverpool() {
     num_counter_pairs = Libraries::Kernel::sceKernelIsNeoMode() ? 16 : 8;
     process_thread = std::jthread{std::bind_front(&Liverpool::Process, this)};
@@ -95,9 +110,12 @@ void Liverpool::Process(std::stop_token stoken) {
 
     while (!stoken.stop_requested()) {
         {
+            // Submitters only take the mutex to wake us up while we are parked here.
             std::unique_lock lk{submit_mutex};
+            is_gpu_waiting = true;
             Common::CondvarWait(submit_cv, lk, stoken,
                                 [this] { return num_commands || num_submits || submit_done; });
+            is_gpu_waiting = false;
         }
         if (stoken.stop_requested()) {
             break;
@@ -114,25 +132,29 @@ void Liverpool::Process(std::stop_token stoken) {
 
             auto& queue = mapped_queues[curr_qid];
 
-            Task::Handle task{};
-            {
-                std::scoped_lock lock{queue.m_access};
-                if (queue.submits.empty()) {
-                    continue;
-                }
-                task = queue.submits.front();
+            Submission* submit = GetSubmit(queue);
+            if (!submit) {
+                continue;
+            }
+            if (!submit->is_started) {
+                const u64 latency_ns = GetTimeNs() - submit->enqueue_ns;
+                queue.dequeue_ns_total.fetch_add(latency_ns, std::memory_order_relaxed);
+                AtomicMax(queue.dequeue_ns_max, latency_ns);
+                submit->is_started = true;
             }
+
+            const Task::Handle task = submit->task;
             task.resume();
 
             if (task.done()) {
                 task.destroy();
+                PopSubmit(queue, submit);
 
-                std::scoped_lock lock{queue.m_access};
-                queue.submits.pop();
-
-                --num_submits;
-                std::scoped_lock lock2{submit_mutex};
-                submit_cv.notify_all();
+                // Only idle waiters are interested in completions.
+                if (--num_submits == 0) {
+                    std::scoped_lock lk{submit_mutex};
+                    submit_cv.notify_all();
+                }
             }
         }
 
@@ -142,6 +164,7 @@ void Liverpool::Process(std::stop_token stoken) {
                 rasterizer->OnSubmit();
                 rasterizer->Flush();
             }
+            pm4_cache.Tick();
             submit_done = false;
         }
 
@@ -231,11 +254,45 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
     }
 
     const auto base_addr = reinterpret_cast<uintptr_t>(dcb.data());
-    while (!dcb.empty()) {
+
+    // Packets are walked from their pre-decoded stream, which is shared between submissions of
+    // the same command buffer.
+    auto decoded = pm4_cache.Get(dcb);
+    size_t decoded_base = 0;
+    size_t op_index = 0;
+
+    // Moves the packet cursor to the specified dword of the command buffer.
+    const auto seek = [&](size_t target_dw) {
+        const auto& ops = decoded->ops;
+        const auto it = std::ranges::lower_bound(ops.begin() + op_index, ops.end(),
+                                                 target_dw - decoded_base, {}, &PM4Op::offset);
+        if (it != ops.end() && it->offset == target_dw - decoded_base) {
+            op_index = std::distance(ops.begin(), it);
+            return;
+        }
+        const auto remaining = NextPacket(dcb, target_dw);
+        decoded = PM4Cache::Decode(remaining);
+        decoded_base = dcb.size() - remaining.size();
+        op_index = 0;
+    };
+
+    while (true) {
+        if (op_index == decoded->ops.size()) {
+            // The decoded stream ends early after a rewind packet, continue past it.
+            const size_t next_dw = decoded_base + decoded->num_dwords;
+            if (next_dw >= dcb.size()) {
+                break;
+            }
+            seek(next_dw);
+            continue;
+        }
+
         ProcessCommands();
 
-        const auto* header = reinterpret_cast<const PM4Header*>(dcb.data());
-        const u32 type = header->type;
+        const PM4Op& op = decoded->ops[op_index++];
+        const auto* header = reinterpret_cast<const PM4Header*>(dcb.data() + decoded_base +
+                                                                 op.offset);
+        const u32 type = op.type;
 
         switch (type) {
         default:
@@ -246,12 +303,10 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
                             header->type0.base.Value(), header->type0.NumWords());
             break;
         case 2:
-            // Type-2 packet are used for padding purposes
-            dcb = NextPacket(dcb, 1);
             continue;
         case 3:
-            const u32 count = header->type3.NumWords();
-            const PM4ItOpcode opcode = header->type3.opcode;
+            const u32 count = op.num_words;
+            const PM4ItOpcode opcode = op.opcode;
             switch (opcode) {
             case PM4ItOpcode::Nop: {
                 const auto* nop = reinterpret_cast<const PM4CmdNop*>(header);
@@ -741,8 +796,7 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
                 // there are no other submits to yield to we can sleep the thread
                 // instead and allow other tasks to run.
                 const u64* wait_addr = wait_reg_mem->Address<u64*>();
-                if (vo_port->IsVoLabel(wait_addr) &&
-                    num_submits == mapped_queues[GfxQueueId].submits.size()) {
+                if (vo_port->IsVoLabel(wait_addr) && !HasSubmitsOutside(GfxQueueId)) {
                     vo_port->WaitVoLabel([&] { return wait_reg_mem->Test(regs.reg_array); });
                     break;
                 }
@@ -800,8 +854,7 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
                 }
                 const auto skip = *cond_exec->Address() == false;
                 if (skip) {
-                    dcb = NextPacket(dcb,
-                                     header->type3.NumWords() + 1 + cond_exec->exec_count.Value());
+                    seek(decoded_base + op.offset + count + 1 + cond_exec->exec_count.Value());
                     continue;
                 }
                 break;
@@ -810,7 +863,6 @@ Liverpool::Task Liverpool::ProcessGraphics(std::span<const u32> dcb, std::span<c
                 UNREACHABLE_MSG("Unknown PM4 type 3 opcode {:#x} with count {}",
                                 static_cast<u32>(opcode), count);
             }
-            dcb = NextPacket(dcb, header->type3.NumWords() + 1);
             break;
         }
     }
@@ -1120,38 +1172,104 @@ Liverpool::CmdBuffer Liverpool::CopyCmdBuffers(std::span<const u32> dcb, std::sp
 }
 
 void Liverpool::SubmitGfx(std::span<const u32> dcb, std::span<const u32> ccb) {
-    auto& queue = mapped_queues[GfxQueueId];
-
     if (Config::copyGPUCmdBuffers()) {
         std::tie(dcb, ccb) = CopyCmdBuffers(dcb, ccb);
     }
 
     auto task = ProcessGraphics(dcb, ccb);
-    {
-        std::scoped_lock lock{queue.m_access};
-        queue.submits.emplace(task.handle);
-    }
-
-    std::scoped_lock lk{submit_mutex};
-    ++num_submits;
-    submit_cv.notify_one();
+    PushSubmit(GfxQueueId, task.handle);
 }
 
 void Liverpool::SubmitAsc(u32 gnm_vqid, std::span<const u32> acb) {
     ASSERT_MSG(gnm_vqid > 0 && gnm_vqid < NumTotalQueues, "Invalid virtual ASC queue index");
-    auto& queue = mapped_queues[gnm_vqid];
 
     const auto vqid = gnm_vqid - 1;
     const auto& task = ProcessCompute(acb, vqid);
-    {
-        std::scoped_lock lock{queue.m_access};
-        queue.submits.emplace(task.handle);
+
+    u32 num_queues = num_mapped_queues.load(std::memory_order_relaxed);
+    while (num_queues < gnm_vqid + 1 &&
+           !num_mapped_queues.compare_exchange_weak(num_queues, gnm_vqid + 1)) {
     }
+    PushSubmit(gnm_vqid, task.handle);
+}
 
-    std::scoped_lock lk{submit_mutex};
-    num_mapped_queues = std::max(num_mapped_queues, gnm_vqid + 1);
+void Liverpool::PushSubmit(u32 qid, Task::Handle task) {
+    auto& queue = mapped_queues[qid];
+
+    // Count the submission before publishing it, so the command processor can never retire it
+    // ahead of the increment and wrap the counter around.
     ++num_submits;
-    submit_cv.notify_one();
+
+    // The command processor only retires a submission once it completes, so a full ring may be
+    // waiting on a label this thread is about to write. Never block on it, queue the submission
+    // behind the ring instead. Once one submission overflows, the following ones do as well until
+    // the overflow is drained, which keeps them in order.
+    const u64 enqueue_ns = GetTimeNs();
+    const Submission submit{task, enqueue_ns, false};
+    if (queue.num_overflow.load(std::memory_order_acquire) != 0 ||
+        !queue.submits.TryPush(submit)) {
+        std::scoped_lock lk{queue.overflow_mutex};
+        queue.overflow.push_back(submit);
+        queue.num_overflow.fetch_add(1, std::memory_order_release);
+    }
+    const u64 latency_ns = GetTimeNs() - enqueue_ns;
+    queue.num_submits.fetch_add(1, std::memory_order_relaxed);
+    queue.enqueue_ns_total.fetch_add(latency_ns, std::memory_order_relaxed);
+    AtomicMax(queue.enqueue_ns_max, latency_ns);
+
+    // Consecutive submissions are batched behind a single wakeup, the mutex is only taken while
+    // the command processor is parked on the condition variable.
+    if (is_gpu_waiting) {
+        std::scoped_lock lk{submit_mutex};
+        submit_cv.notify_all();
+    }
+}
+
+bool Liverpool::HasSubmitsOutside(u32 qid) const {
+    // Ask the queues themselves, num_submits is raised before a submission enters its ring.
+    const u32 num_queues = num_mapped_queues.load(std::memory_order_relaxed);
+    for (u32 i = 0; i < num_queues; ++i) {
+        const auto& queue = mapped_queues[i];
+        if (i != qid && (queue.submits.Size() != 0 ||
+                         queue.num_overflow.load(std::memory_order_relaxed) != 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Liverpool::Submission* Liverpool::GetSubmit(GpuQueue& queue) {
+    Submission* submit = queue.submits.Front();
+    if (queue.num_overflow.load(std::memory_order_acquire) == 0 ||
+        (submit && submit->is_started)) {
+        return submit;
+    }
+    // Overflowed submissions go after the ring, unless one of them has already been started.
+    // Pointers to deque elements stay valid while producers append to it.
+    std::scoped_lock lk{queue.overflow_mutex};
+    Submission& front = queue.overflow.front();
+    return !submit || front.is_started ? &front : submit;
+}
+
+void Liverpool::PopSubmit(GpuQueue& queue, const Submission* submit) {
+    if (submit == queue.submits.Front()) {
+        queue.submits.Pop();
+        return;
+    }
+    std::scoped_lock lk{queue.overflow_mutex};
+    queue.overflow.pop_front();
+    queue.num_overflow.fetch_sub(1, std::memory_order_release);
+}
+
+Liverpool::SubmitQueueStats Liverpool::GetSubmitQueueStats(u32 qid) const {
+    const auto& queue = mapped_queues[qid];
+    return SubmitQueueStats{
+        .num_submits = queue.num_submits.load(std::memory_order_relaxed),
+        .enqueue_ns_total = queue.enqueue_ns_total.load(std::memory_order_relaxed),
+        .enqueue_ns_max = queue.enqueue_ns_max.load(std::memory_order_relaxed),
+        .dequeue_ns_total = queue.dequeue_ns_total.load(std::memory_order_relaxed),
+        .dequeue_ns_max = queue.dequeue_ns_max.load(std::memory_order_relaxed),
+    };
 }
 
 } // namespace AmdGpu
@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <coroutine>
+#include <deque>
 #include <exception>
 #include <mutex>
 #include <semaphore>
@@ -18,7 +20,9 @@
 #include "common/types.h"
 #include "common/unique_function.h"
 #include "video_core/amdgpu/cb_db_extent.h"
+#include "video_core/amdgpu/pm4_cache.h"
 #include "video_core/amdgpu/regs.h"
+#include "video_core/amdgpu/submit_ring.h"
 
 namespace Vulkan {
 class Rasterizer;
@@ -38,6 +42,7 @@ struct Liverpool {
     static constexpr u32 NumComputeRings = NumComputePipes * NumQueuesPerPipe;
     static constexpr u32 NumTotalQueues = NumGfxRings + NumComputeRings;
     static_assert(NumTotalQueues < 64u); // need to fit into u64 bitmap for ffs
+    static constexpr size_t SubmitRingSize = 512u;
 
     enum ContextRegs : u32 {
         DbZInfo = 0xA010,
@@ -87,6 +92,16 @@ public:
         return num_submits == 0;
     }
 
+    struct SubmitQueueStats {
+        u64 num_submits;
+        u64 enqueue_ns_total; ///< Time spent by submitters pushing into the ring
+        u64 enqueue_ns_max;
+        u64 dequeue_ns_total; ///< Time between the push and the command processor picking it up
+        u64 dequeue_ns_max;
+    };
+
+    SubmitQueueStats GetSubmitQueueStats(u32 qid) const;
+
     void SetVoPort(Libraries::VideoOut::VideoOutPort* port) {
         vo_port = port;
     }
@@ -122,7 +137,6 @@ public:
 
     void ReserveCopyBufferSpace() {
         GpuQueue& gfx_queue = mapped_queues[GfxQueueId];
-        std::scoped_lock lk(gfx_queue.m_access);
         constexpr size_t GfxReservedSize = 2_MB >> 2;
         gfx_queue.ccb_buffer.reserve(GfxReservedSize);
         gfx_queue.dcb_buffer.reserve(GfxReservedSize);
@@ -183,21 +197,47 @@ private:
     template <bool is_indirect = false>
     Task ProcessCompute(std::span<const u32> acb, u32 vqid);
 
+    void PushSubmit(u32 qid, Task::Handle task);
+
+    /// Returns true if any queue other than qid has pending submissions.
+    bool HasSubmitsOutside(u32 qid) const;
+
     void ProcessCommands();
     void Process(std::stop_token stoken);
 
+    struct Submission {
+        Task::Handle task;
+        u64 enqueue_ns;
+        bool is_started;
+    };
+
     struct GpuQueue {
-        std::mutex m_access{};
         std::atomic<u32> dcb_buffer_offset;
         std::atomic<u32> ccb_buffer_offset;
         std::vector<u32> dcb_buffer;
         std::vector<u32> ccb_buffer;
-        std::queue<Task::Handle> submits{};
+        SubmitRing<Submission, SubmitRingSize> submits{};
+        // Submissions that did not fit in the ring, they run after the ring has been drained.
+        std::mutex overflow_mutex;
+        std::deque<Submission> overflow;
+        std::atomic<u32> num_overflow{};
         ComputeProgram cs_state{};
+        std::atomic<u64> num_submits{};
+        std::atomic<u64> enqueue_ns_total{};
+        std::atomic<u64> enqueue_ns_max{};
+        std::atomic<u64> dequeue_ns_total{};
+        std::atomic<u64> dequeue_ns_max{};
     };
     std::array<GpuQueue, NumTotalQueues> mapped_queues{};
-    u32 num_mapped_queues{1u}; // GFX is always available
+    std::atomic<u32> num_mapped_queues{1u}; // GFX is always available
+
+    /// Returns the submission of the queue to run next, or nullptr if it has none.
+    static Submission* GetSubmit(GpuQueue& queue);
+
+    /// Removes the submission returned by GetSubmit once it has completed.
+    static void PopSubmit(GpuQueue& queue, const Submission* submit);
 
+    PM4Cache pm4_cache;
     VAddr indirect_args_addr{};
     u32 num_counter_pairs{};
     u64 pixel_counter{};
@@ -226,6 +266,7 @@ private:
     std::atomic<u32> num_submits{};
     std::atomic<u32> num_commands{};
     std::atomic<bool> submit_done{};
+    std::atomic<bool> is_gpu_waiting{};
     std::mutex submit_mutex;
     std::condition_variable_any submit_cv;
     std::queue<Common::UniqueFunction<void>> command_queue{};
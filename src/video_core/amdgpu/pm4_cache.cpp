@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "common/logging/log.h"
+#include "video_core/amdgpu/pm4_cache.h"
+#include "video_core/amdgpu/pm4_cmds.h"
+
+namespace AmdGpu {
+
+// Number of ticks a decoded stream is kept around without being submitted.
+static constexpr u64 MaxUnusedTicks = 120;
+
+std::shared_ptr<const DecodedCmdBuffer> PM4Cache::Decode(std::span<const u32> cmdbuf) {
+    auto decoded = std::make_shared<DecodedCmdBuffer>();
+
+    u32 offset = 0;
+    while (offset < cmdbuf.size()) {
+        const auto* header = reinterpret_cast<const PM4Header*>(cmdbuf.data() + offset);
+        decoded->headers.push_back(cmdbuf[offset]);
+        PM4Op& op = decoded->ops.emplace_back(PM4Op{
+            .offset = offset,
+            .num_words = static_cast<u16>(header->type3.NumWords()),
+            .type = static_cast<u8>(header->type.Value()),
+            .opcode = header->type3.opcode,
+        });
+        if (op.type == 2) {
+            // Type-2 packet are used for padding purposes
+            ++offset;
+            continue;
+        }
+        if (op.type != 3) {
+            // Only type 3 packets can be walked, leave the rest to the command processor.
+            offset = cmdbuf.size();
+            break;
+        }
+        const u32 packet_size = op.num_words + 1;
+        if (offset + packet_size > cmdbuf.size()) {
+            LOG_ERROR(Lib_GnmDriver,
+                      "packet length exceeds remaining submission size. Packet dword count={}, "
+                      "remaining submission dwords={}",
+                      packet_size, cmdbuf.size() - offset);
+            offset = cmdbuf.size();
+            break;
+        }
+        offset += packet_size;
+        if (op.opcode == PM4ItOpcode::Rewind) {
+            break;
+        }
+    }
+    decoded->num_dwords = offset;
+    return decoded;
+}
+
+bool DecodedCmdBuffer::Matches(std::span<const u32> cmdbuf) const {
+    // The walk only depends on the header dwords it visits, if all of them are unchanged it
+    // visits the same ones again. Packet payloads are never read here.
+    if (num_dwords != cmdbuf.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < ops.size(); ++i) {
+        if (cmdbuf[ops[i].offset] != headers[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const DecodedCmdBuffer> PM4Cache::Get(std::span<const u32> cmdbuf) {
+    // Command buffers are keyed by their address. Rather than hashing the whole buffer, the
+    // stream is revalidated against the packet headers it was decoded from.
+    const auto address = reinterpret_cast<uintptr_t>(cmdbuf.data());
+    const auto it = entries.find(address);
+    if (it != entries.end() && it->second.decoded->Matches(cmdbuf)) {
+        it.value().last_used_tick = current_tick;
+        return it->second.decoded;
+    }
+
+    auto decoded = Decode(cmdbuf);
+    if (!decoded->ops.empty() && decoded->num_dwords == cmdbuf.size() &&
+        decoded->ops.back().opcode != PM4ItOpcode::Rewind) {
+        entries.insert_or_assign(address, Entry{decoded, current_tick});
+    } else if (it != entries.end()) {
+        entries.erase(it);
+    }
+    return decoded;
+}
+
+void PM4Cache::Tick() {
+    ++current_tick;
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (current_tick - it->second.last_used_tick > MaxUnusedTicks) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace AmdGpu
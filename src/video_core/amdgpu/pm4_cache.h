@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+#include <tsl/robin_map.h>
+
+#include "common/types.h"
+#include "video_core/amdgpu/pm4_opcodes.h"
+
+namespace AmdGpu {
+
+/// Header fields of a single PM4 packet.
+struct PM4Op {
+    u32 offset;    ///< Dword offset of the packet header in the command buffer
+    u16 num_words; ///< Number of dwords following the header
+    u8 type;       ///< PM4 packet type
+    PM4ItOpcode opcode;
+};
+
+/// Pre-decoded packet stream of a command buffer. Decoding stops after the first rewind packet,
+/// as the commands following it are only valid once the rewind is.
+struct DecodedCmdBuffer {
+    std::vector<PM4Op> ops;
+    std::vector<u32> headers; ///< Raw header dword of each op, to revalidate the stream with
+    u32 num_dwords{};         ///< Number of command buffer dwords covered by the ops
+
+    /// Returns true if decoding the command buffer would produce this stream again.
+    bool Matches(std::span<const u32> cmdbuf) const;
+};
+
+/**
+ * Caches the decoded packet streams of command buffers by their address. Games tend to submit
+ * the same command buffers every frame, in which case the packet headers are only walked once
+ * and subsequent submissions replay the decoded stream.
+ */
+class PM4Cache {
+public:
+    /// Decodes the packets of a command buffer, without caching the result.
+    static std::shared_ptr<const DecodedCmdBuffer> Decode(std::span<const u32> cmdbuf);
+
+    /// Returns the decoded packets of a command buffer, reusing previous decodes.
+    std::shared_ptr<const DecodedCmdBuffer> Get(std::span<const u32> cmdbuf);
+
+    /// Advances the cache age, evicting the streams that have not been used for a while.
+    void Tick();
+
+private:
+    struct Entry {
+        std::shared_ptr<const DecodedCmdBuffer> decoded;
+        u64 last_used_tick;
+    };
+
+    tsl::robin_map<uintptr_t, Entry> entries;
+    u64 current_tick{};
+};
+
+} // namespace AmdGpu
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+
+#include "common/types.h"
+
+namespace AmdGpu {
+
+/// Bounded lock-free ring carrying submissions to the command processor. The GPU thread is the
+/// only consumer and may keep the oldest element in place while it is being executed. Producers
+/// claim slots with a single CAS, so the uncontended path of the guest submission thread costs
+/// the same as a plain SPSC ring while concurrent submitters of the same queue stay safe.
+template <typename T, size_t Capacity>
+class SubmitRing {
+    static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+public:
+    SubmitRing() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// Appends an element to the ring. Returns false if the ring is full.
+    bool TryPush(const T& value) {
+        size_t pos = write_pos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & Mask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<s64>(sequence) - static_cast<s64>(pos);
+            if (diff == 0) {
+                if (write_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = write_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Returns the oldest element without removing it, or nullptr if the ring is empty.
+    /// Must only be called from the consumer thread.
+    T* Front() {
+        const size_t pos = read_pos.load(std::memory_order_relaxed);
+        Cell& cell = cells[pos & Mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) {
+            return nullptr;
+        }
+        return &cell.value;
+    }
+
+    /// Removes the oldest element, which must have been observed with Front() before.
+    /// Must only be called from the consumer thread.
+    void Pop() {
+        const size_t pos = read_pos.load(std::memory_order_relaxed);
+        cells[pos & Mask].sequence.store(pos + Capacity, std::memory_order_release);
+        read_pos.store(pos + 1, std::memory_order_relaxed);
+    }
+
+    /// Returns the number of claimed slots. Only an estimate while producers are active.
+    size_t Size() const {
+        return write_pos.load(std::memory_order_relaxed) -
+               read_pos.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t Mask = Capacity - 1;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    alignas(64) std::atomic<size_t> write_pos{0};
+    alignas(64) std::atomic<size_t> read_pos{0};
+    alignas(64) std::array<Cell, Capacity> cells;
+};
+
+} // namespace AmdGpu
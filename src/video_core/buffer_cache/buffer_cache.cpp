@@ -390,12 +390,19 @@ std::pair<Buffer*, u32> BufferCache::ObtainBuffer(VAddr device_addr, u32 size, b
     return {&buffer, buffer.Offset(device_addr)};
 }
 
-std::pair<Buffer*, u32> BufferCache::ObtainBufferForImage(VAddr gpu_addr, u32 size) {
+std::pair<Buffer*, u32> BufferCache::ObtainBufferForImage(
+    VAddr gpu_addr, u32 size, std::span<const std::pair<u32, u32>> ranges) {
+    const std::pair<u32, u32> whole_range{0, size};
+    if (ranges.empty()) {
+        ranges = std::span{&whole_range, 1};
+    }
     // Check if any buffer contains the full requested range.
     const BufferId buffer_id = page_table[gpu_addr >> CACHING_PAGEBITS].buffer_id;
     if (buffer_id) {
         if (Buffer& buffer = slot_buffers[buffer_id]; buffer.IsInBounds(gpu_addr, size)) {
-            SynchronizeBuffer(buffer, gpu_addr, size, false, false);
+            for (const auto& [offset, range_size] : ranges) {
+                SynchronizeBuffer(buffer, gpu_addr + offset, range_size, false, false);
+            }
             return {&buffer, buffer.Offset(gpu_addr)};
         }
     }
@@ -405,7 +412,9 @@ std::pair<Buffer*, u32> BufferCache::ObtainBufferForImage(VAddr gpu_addr, u32 si
     }
     // In all other cases, just do a CPU copy to the staging buffer.
     const auto [data, offset] = staging_buffer.Map(size, 16);
-    memory->CopySparseMemory(gpu_addr, data, size);
+    for (const auto& [range_offset, range_size] : ranges) {
+        memory->CopySparseMemory(gpu_addr + range_offset, data + range_offset, range_size);
+    }
     staging_buffer.Commit();
     return {&staging_buffer, offset};
 }
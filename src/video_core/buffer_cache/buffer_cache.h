@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include <boost/container/small_vector.hpp>
 #include "common/lru_cache.h"
 #include "common/slot_vector.h"
@@ -128,8 +129,10 @@ public:
                                                        bool is_texel_buffer = false,
                                                        BufferId buffer_id = {});
 
-    /// Attempts to obtain a buffer without modifying the cache contents.
-    [[nodiscard]] std::pair<Buffer*, u32> ObtainBufferForImage(VAddr gpu_addr, u32 size);
+    /// Attempts to obtain a buffer without modifying the cache contents. When ranges are given as
+    /// offset and size pairs, only those parts of the region are brought up to date.
+    [[nodiscard]] std::pair<Buffer*, u32> ObtainBufferForImage(
+        VAddr gpu_addr, u32 size, std::span<const std::pair<u32, u32>> ranges = {});
 
     /// Return true when a region is registered on the cache
     [[nodiscard]] bool IsRegionRegistered(VAddr addr, size_t size);
@@ -12,27 +12,377 @@
 #include "video_core/renderer_vulkan/vk_pipeline_cache.h"
 
 #include <miniz.h>
+#include <tsl/robin_map.h>
+#include <xxhash.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <mutex>
+#include <optional>
 #include <queue>
+#include <shared_mutex>
+
+namespace Storage {
 
 namespace {
 
+constexpr u32 NUM_SHARDS = 16;
+constexpr u32 PACK_VERSION = 1;
+constexpr u32 RECORD_MAGIC = 0x424F4C42; // BLOB
+constexpr u32 INDEX_MAGIC = 0x58444E49;  // INDX
+constexpr size_t READ_BATCH_SIZE = 1024;
+constexpr u32 MAX_READ_WORKERS = 8;
+
+/// Header preceding every compressed blob in a shard file. Shards are append only and can be
+/// rebuilt into an index by walking these headers.
+struct RecordHeader {
+    u32 magic;
+    BlobType type;
+    u64 name_hash;
+    u64 content_hash;
+    u32 compressed_size;
+    u32 size;
+};
+static_assert(sizeof(RecordHeader) == 32);
+
+struct IndexEntry {
+    u64 name_hash;
+    u64 content_hash;
+    u64 offset; ///< Offset of the compressed payload in the shard
+    u32 compressed_size;
+    u32 size;
+    BlobType type;
+    u32 shard;
+};
+static_assert(sizeof(IndexEntry) == 40);
+
+/// The index file is this header followed by entries sorted by name hash, and is mapped as is.
+struct IndexHeader {
+    u32 magic;
+    u32 version;
+    u32 num_shards;
+    u32 num_entries;
+    std::array<u64, NUM_SHARDS> shard_sizes;
+};
+
+/// Sharded blob archive with a memory mapped index. Blobs are addressed by the hash of their name
+/// and compressed individually, so lookups are random access and can be decompressed from
+/// several threads at once. New blobs are appended to their shard; only the index is rewritten.
+class PackArchive {
+public:
+    bool Open(const std::filesystem::path& path);
+    void Close();
+
+    [[nodiscard]] bool IsEmpty() const;
+    [[nodiscard]] std::optional<IndexEntry> Find(u64 name_hash) const;
+    [[nodiscard]] std::vector<IndexEntry> Collect(BlobType type) const;
+    [[nodiscard]] std::vector<u8> Read(const IndexEntry& entry);
+    void Append(BlobType type, u64 name_hash, std::span<const u8> data);
+
+private:
+    struct Shard {
+        Common::FS::IOFile file;
+        Common::FS::MappedFile map;
+        std::mutex mutex;
+        u64 size{};
+    };
+
+    bool LoadIndex(std::array<u64, NUM_SHARDS>& shard_sizes);
+    void ScanShard(u32 shard_index, u64 offset);
+    void WriteIndex();
+
+    std::filesystem::path root{};
+    Common::FS::MappedFile index_map{};
+    std::span<const IndexEntry> index{};
+    std::array<Shard, NUM_SHARDS> shards{};
+    mutable std::shared_mutex entries_mutex{};
+    tsl::robin_map<u64, IndexEntry> new_entries{};
+    bool index_dirty{};
+};
+
+bool PackArchive::Open(const std::filesystem::path& path) {
+    using namespace Common::FS;
+    root = path;
+    std::error_code ec;
+    std::filesystem::create_directories(root, ec);
+
+    for (u32 i = 0; i < NUM_SHARDS; ++i) {
+        auto& shard = shards[i];
+        shard.file.Open(root / fmt::format("shard_{:02}.bin", i), FileAccessMode::ReadAppend,
+                        FileType::BinaryFile, FileShareFlag::ShareReadWrite);
+        if (!shard.file.IsOpen()) {
+            Close();
+            return false;
+        }
+        shard.size = shard.file.GetSize();
+    }
+
+    std::array<u64, NUM_SHARDS> indexed_sizes{};
+    if (LoadIndex(indexed_sizes)) {
+        for (u32 i = 0; i < NUM_SHARDS; ++i) {
+            if (indexed_sizes[i] > shards[i].size) {
+                LOG_WARNING(Render, "Cache index is out of date, rebuilding");
+                index = {};
+                index_map.Close();
+                indexed_sizes.fill(0);
+                break;
+            }
+        }
+    }
+
+    // Pick up records appended after the index was last written, e.g. after a crash.
+    for (u32 i = 0; i < NUM_SHARDS; ++i) {
+        ScanShard(i, indexed_sizes[i]);
+    }
+    return true;
+}
+
+void PackArchive::Close() {
+    if (index_dirty) {
+        WriteIndex();
+    }
+    index = {};
+    index_map.Close();
+    for (auto& shard : shards) {
+        shard.map.Close();
+        shard.file.Close();
+        shard.size = 0;
+    }
+    new_entries.clear();
+    index_dirty = false;
+}
+
+bool PackArchive::IsEmpty() const {
+    std::shared_lock lk{entries_mutex};
+    return index.empty() && new_entries.empty();
+}
+
+std::optional<IndexEntry> PackArchive::Find(u64 name_hash) const {
+    {
+        std::shared_lock lk{entries_mutex};
+        if (const auto it = new_entries.find(name_hash); it != new_entries.end()) {
+            return it->second;
+        }
+    }
+    const auto it = std::ranges::lower_bound(index, name_hash, {}, &IndexEntry::name_hash);
+    if (it != index.end() && it->name_hash == name_hash) {
+        return *it;
+    }
+    return std::nullopt;
+}
+
+std::vector<IndexEntry> PackArchive::Collect(BlobType type) const {
+    std::vector<IndexEntry> entries{};
+    {
+        std::shared_lock lk{entries_mutex};
+        for (const auto& entry : index) {
+            if (entry.type == type && !new_entries.contains(entry.name_hash)) {
+                entries.push_back(entry);
+            }
+        }
+        for (const auto& [_, entry] : new_entries) {
+            if (entry.type == type) {
+                entries.push_back(entry);
+            }
+        }
+    }
+    // Walk the shards sequentially to keep the mapped reads local.
+    std::ranges::sort(entries, [](const IndexEntry& lhs, const IndexEntry& rhs) {
+        return std::tie(lhs.shard, lhs.offset) < std::tie(rhs.shard, rhs.offset);
+    });
+    return entries;
+}
+
+std::vector<u8> PackArchive::Read(const IndexEntry& entry) {
+    auto& shard = shards[entry.shard];
+    const u8* compressed = nullptr;
+    std::vector<u8> staging{};
+    if (entry.offset + entry.compressed_size <= shard.map.Size()) {
+        compressed = shard.map.Data().data() + entry.offset;
+    } else {
+        // Appended after the shard was mapped.
+        staging.resize(entry.compressed_size);
+        std::scoped_lock lk{shard.mutex};
+        if (!shard.file.Seek(entry.offset) ||
+            shard.file.ReadRaw<u8>(staging.data(), staging.size()) != staging.size()) {
+            return {};
+        }
+        compressed = staging.data();
+    }
+
+    std::vector<u8> data(entry.size);
+    mz_ulong size = entry.size;
+    if (mz_uncompress(data.data(), &size, compressed, entry.compressed_size) != MZ_OK ||
+        size != entry.size) {
+        LOG_ERROR(Render, "Failed to decompress cache blob {:#018x}", entry.name_hash);
+        return {};
+    }
+    return data;
+}
+
+void PackArchive::Append(BlobType type, u64 name_hash, std::span<const u8> data) {
+    const u64 content_hash = XXH3_64bits(data.data(), data.size());
+    if (const auto entry = Find(name_hash); entry && entry->content_hash == content_hash) {
+        return;
+    }
+
+    std::vector<u8> record(sizeof(RecordHeader) + mz_compressBound(data.size()));
+    mz_ulong compressed_size = record.size() - sizeof(RecordHeader);
+    if (mz_compress2(record.data() + sizeof(RecordHeader), &compressed_size, data.data(),
+                     data.size(), MZ_BEST_COMPRESSION) != MZ_OK) {
+        LOG_ERROR(Render, "Failed to compress cache blob {:#018x}", name_hash);
+        return;
+    }
+    const RecordHeader header = {
+        .magic = RECORD_MAGIC,
+        .type = type,
+        .name_hash = name_hash,
+        .content_hash = content_hash,
+        .compressed_size = static_cast<u32>(compressed_size),
+        .size = static_cast<u32>(data.size()),
+    };
+    std::memcpy(record.data(), &header, sizeof(header));
+    record.resize(sizeof(RecordHeader) + compressed_size);
+
+    const u32 shard_index = name_hash % NUM_SHARDS;
+    auto& shard = shards[shard_index];
+    IndexEntry entry = {
+        .name_hash = name_hash,
+        .content_hash = content_hash,
+        .compressed_size = header.compressed_size,
+        .size = header.size,
+        .type = type,
+        .shard = shard_index,
+    };
+    {
+        std::scoped_lock lk{shard.mutex};
+        shard.file.Seek(0, Common::FS::SeekOrigin::End);
+        if (shard.file.WriteRaw<u8>(record.data(), record.size()) != record.size()) {
+            LOG_ERROR(Render, "Failed to append cache blob {:#018x}", name_hash);
+            return;
+        }
+        entry.offset = shard.size + sizeof(RecordHeader);
+        shard.size += record.size();
+    }
+
+    std::unique_lock lk{entries_mutex};
+    new_entries[name_hash] = entry;
+    index_dirty = true;
+}
+
+bool PackArchive::LoadIndex(std::array<u64, NUM_SHARDS>& shard_sizes) {
+    if (!index_map.Open(root / "index.bin")) {
+        return false;
+    }
+    const auto data = index_map.Data();
+    IndexHeader header{};
+    if (data.size() >= sizeof(header)) {
+        std::memcpy(&header, data.data(), sizeof(header));
+    }
+    if (header.magic != INDEX_MAGIC || header.version != PACK_VERSION ||
+        header.num_shards != NUM_SHARDS ||
+        data.size() != sizeof(header) + header.num_entries * sizeof(IndexEntry)) {
+        LOG_WARNING(Render, "Cache index is invalid, rebuilding");
+        index_map.Close();
+        return false;
+    }
+    index = {reinterpret_cast<const IndexEntry*>(data.data() + sizeof(header)),
+             header.num_entries};
+    shard_sizes = header.shard_sizes;
+    return true;
+}
+
+void PackArchive::ScanShard(u32 shard_index, u64 offset) {
+    auto& shard = shards[shard_index];
+    const auto shard_path = root / fmt::format("shard_{:02}.bin", shard_index);
+    shard.map.Open(shard_path);
+    const auto data = shard.map.Data();
+    while (offset + sizeof(RecordHeader) <= data.size()) {
+        RecordHeader header{};
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        const u64 payload = offset + sizeof(RecordHeader);
+        if (header.magic != RECORD_MAGIC || payload + header.compressed_size > data.size()) {
+            break;
+        }
+        new_entries[header.name_hash] = {
+            .name_hash = header.name_hash,
+            .content_hash = header.content_hash,
+            .offset = payload,
+            .compressed_size = header.compressed_size,
+            .size = header.size,
+            .type = header.type,
+            .shard = shard_index,
+        };
+        offset = payload + header.compressed_size;
+        index_dirty = true;
+    }
+
+    if (offset < shard.size) {
+        // Drop the partially written tail so that new records stay reachable by the scan.
+        LOG_WARNING(Render, "Discarding {} bytes of corrupted data in cache shard {}",
+                    shard.size - offset, shard_index);
+        shard.map.Close();
+        shard.file.SetSize(offset);
+        shard.size = offset;
+        shard.map.Open(shard_path);
+        index_dirty = true;
+    }
+}
+
+void PackArchive::WriteIndex() {
+    using namespace Common::FS;
+    std::vector<IndexEntry> entries{};
+    entries.reserve(index.size() + new_entries.size());
+    for (const auto& entry : index) {
+        if (!new_entries.contains(entry.name_hash)) {
+            entries.push_back(entry);
+        }
+    }
+    for (const auto& [_, entry] : new_entries) {
+        entries.push_back(entry);
+    }
+    std::ranges::sort(entries, {}, &IndexEntry::name_hash);
+
+    IndexHeader header = {
+        .magic = INDEX_MAGIC,
+        .version = PACK_VERSION,
+        .num_shards = NUM_SHARDS,
+        .num_entries = static_cast<u32>(entries.size()),
+    };
+    for (u32 i = 0; i < NUM_SHARDS; ++i) {
+        header.shard_sizes[i] = shards[i].size;
+    }
+
+    // The mapping has to go before the file can be replaced on Windows.
+    index = {};
+    index_map.Close();
+
+    const auto tmp_path = root / "index.bin.tmp";
+    {
+        const auto file = IOFile{tmp_path, FileAccessMode::Create};
+        if (file.Write(header) != 1 || file.Write(entries) != entries.size()) {
+            LOG_ERROR(Render, "Failed to write cache index");
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, root / "index.bin", ec);
+    if (ec) {
+        LOG_ERROR(Render, "Failed to replace cache index: {}", ec.message());
+    }
+}
+
 std::mutex submit_mutex{};
 u32 num_requests{};
 std::condition_variable_any request_cv{};
 std::queue<std::packaged_task<void()>> req_queue{};
 std::mutex m_request{};
 
-mz_zip_archive zip_ar{};
-bool ar_is_read_only{true};
+PackArchive pack{};
 
-} // namespace
-
-namespace Storage {
+} // Anonymous namespace
 
 void ProcessIO(const std::stop_token& stoken) {
     Common::SetCurrentThreadName("shadPS4:PipelineCacheIO");
@@ -43,10 +393,7 @@ void ProcessIO(const std::stop_token& stoken) {
             Common::CondvarWait(request_cv, lk, stoken, [&] { return num_requests; });
         }
 
-        if (stoken.stop_requested()) {
-            break;
-        }
-
+        // Requests still queued on stop are drained so that data saved at exit is not lost.
         while (num_requests) {
             std::packaged_task<void()> request{};
             {
@@ -82,11 +429,58 @@ constexpr std::string GetBlobFileExtension(BlobType type) {
     case BlobType::ShaderProfile: {
         return "bin";
     }
+    case BlobType::PipelineUsage: {
+        return "use";
+    }
     default:
         UNREACHABLE();
     }
 }
 
+u64 GetNameHash(BlobType type, const std::string& name) {
+    return XXH3_64bits_withSeed(name.data(), name.size(), static_cast<u64>(type));
+}
+
+std::optional<BlobType> GetBlobTypeFromExtension(std::string_view ext) {
+    for (const auto type : {BlobType::ShaderMeta, BlobType::ShaderBinary, BlobType::PipelineKey,
+                            BlobType::ShaderProfile, BlobType::PipelineUsage}) {
+        if (ext == GetBlobFileExtension(type)) {
+            return type;
+        }
+    }
+    return std::nullopt;
+}
+
+/// Moves the contents of a zip archive written by older versions into the pack.
+void ImportZipArchive(const std::filesystem::path& zip_path) {
+    mz_zip_archive zip_ar{};
+    mz_zip_zero_struct(&zip_ar);
+    if (!mz_zip_reader_init_file(&zip_ar, zip_path.string().c_str(), 0)) {
+        return;
+    }
+
+    u32 num_imported{};
+    const auto num_files = mz_zip_reader_get_num_files(&zip_ar);
+    for (u32 index = 0; index < num_files; ++index) {
+        std::array<char, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE> file_name{};
+        mz_zip_reader_get_filename(&zip_ar, index, file_name.data(), file_name.size());
+        const std::filesystem::path path{file_name.data()};
+        const auto ext = path.extension().string();
+        const auto type = ext.empty() ? std::nullopt : GetBlobTypeFromExtension(ext.substr(1));
+        mz_zip_archive_file_stat stat{};
+        if (!type || !mz_zip_reader_file_stat(&zip_ar, index, &stat)) {
+            continue;
+        }
+        std::vector<u8> data(stat.m_uncomp_size);
+        if (mz_zip_reader_extract_to_mem(&zip_ar, index, data.data(), data.size(), 0)) {
+            pack.Append(*type, GetNameHash(*type, path.stem().string()), data);
+            ++num_imported;
+        }
+    }
+    mz_zip_reader_end(&zip_ar);
+    LOG_INFO(Render, "Imported {} blobs from cache archive {}", num_imported, zip_path.string());
+}
+
 void DataBase::Open() {
     if (opened) {
         return;
@@ -96,18 +490,16 @@ void DataBase::Open() {
 
     using namespace Common::FS;
     if (Config::isPipelineCacheArchived()) {
-        mz_zip_zero_struct(&zip_ar);
-
         cache_path = GetUserPath(PathType::CacheDir) /
-                     std::filesystem::path{game_info.GameSerial()}.replace_extension(".zip");
-
-        if (!mz_zip_reader_init_file(&zip_ar, cache_path.string().c_str(),
-                                     MZ_ZIP_FLAG_READ_ALLOW_WRITING) ||
-            !mz_zip_validate_archive(&zip_ar, 0)) {
-            LOG_INFO(Render, "Cache archive {} is not found or archive is corrupted",
-                     cache_path.string().c_str());
-            mz_zip_reader_end(&zip_ar);
-            mz_zip_writer_init_file(&zip_ar, cache_path.string().c_str(), 0);
+                     std::filesystem::path{game_info.GameSerial()}.replace_extension(".pack");
+        if (!pack.Open(cache_path)) {
+            LOG_ERROR(Render, "Failed to open cache archive {}", cache_path.string());
+            return;
+        }
+
+        const auto zip_path = std::filesystem::path{cache_path}.replace_extension(".zip");
+        if (pack.IsEmpty() && std::filesystem::exists(zip_path)) {
+            ImportZipArchive(zip_path);
         }
     } else {
         cache_path = GetUserPath(PathType::CacheDir) / game_info.GameSerial();
@@ -125,12 +517,16 @@ void DataBase::Close() {
         return;
     }
 
+    for (const auto& [_, func] : close_callbacks) {
+        func();
+    }
+    close_callbacks.clear();
+
     io_worker.request_stop();
     io_worker.join();
 
     if (Config::isPipelineCacheArchived()) {
-        mz_zip_writer_finalize_archive(&zip_ar);
-        mz_zip_writer_end(&zip_ar);
+        pack.Close();
     }
 
     LOG_INFO(Render, "Cache dumped");
@@ -141,16 +537,13 @@ bool WriteVector(const BlobType type, std::filesystem::path&& path_, std::vector
     {
         auto request = std::packaged_task<void()>{[=]() {
             auto path{path_};
-            path.replace_extension(GetBlobFileExtension(type));
             if (Config::isPipelineCacheArchived()) {
-                ASSERT_MSG(!ar_is_read_only,
-                           "The archive is read-only. Did you forget to call `FinishPreload`?");
-                if (!mz_zip_writer_add_mem(&zip_ar, path.string().c_str(), v.data(),
-                                           v.size() * sizeof(T), MZ_BEST_COMPRESSION)) {
-                    LOG_ERROR(Render, "Failed to add {} to the archive", path.string().c_str());
-                }
+                const auto bytes = std::as_bytes(std::span{v});
+                pack.Append(type, GetNameHash(type, path.string()),
+                            {reinterpret_cast<const u8*>(bytes.data()), bytes.size()});
             } else {
                 using namespace Common::FS;
+                path.replace_extension(GetBlobFileExtension(type));
                 const auto file = IOFile{path, FileAccessMode::Create};
                 file.Write(v);
             }
@@ -168,19 +561,17 @@ bool WriteVector(const BlobType type, std::filesystem::path&& path_, std::vector
 template <typename T>
 void LoadVector(BlobType type, std::filesystem::path& path, std::vector<T>& v) {
     using namespace Common::FS;
-    path.replace_extension(GetBlobFileExtension(type));
     if (Config::isPipelineCacheArchived()) {
-        int index{-1};
-        index = mz_zip_reader_locate_file(&zip_ar, path.string().c_str(), nullptr, 0);
-        if (index < 0) {
-            LOG_WARNING(Render, "File {} is not found in the archive", path.string().c_str());
+        const auto entry = pack.Find(GetNameHash(type, path.string()));
+        if (!entry || entry->type != type) {
+            LOG_WARNING(Render, "File {} is not found in the archive", path.string());
             return;
         }
-        mz_zip_archive_file_stat stat{};
-        mz_zip_reader_file_stat(&zip_ar, index, &stat);
-        v.resize(stat.m_uncomp_size / sizeof(T));
-        mz_zip_reader_extract_to_mem(&zip_ar, index, v.data(), stat.m_uncomp_size, 0);
+        const auto data = pack.Read(*entry);
+        v.resize(data.size() / sizeof(T));
+        std::memcpy(v.data(), data.data(), v.size() * sizeof(T));
     } else {
+        path.replace_extension(GetBlobFileExtension(type));
         const auto file = IOFile{path, FileAccessMode::Read};
         v.resize(file.GetSize() / sizeof(T));
         file.Read(v);
@@ -226,17 +617,29 @@ void DataBase::Load(BlobType type, const std::string& name, std::vector<u32>& da
 void DataBase::ForEachBlob(BlobType type, const std::function<void(std::vector<u8>&& data)>& func) {
     const auto& ext = GetBlobFileExtension(type);
     if (Config::isPipelineCacheArchived()) {
-        const auto num_files = mz_zip_reader_get_num_files(&zip_ar);
-        for (int index = 0; index < num_files; ++index) {
-            std::array<char, MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE> file_name{};
-            file_name.fill(0);
-            mz_zip_reader_get_filename(&zip_ar, index, file_name.data(), file_name.size());
-            if (std::string{file_name.data()}.ends_with(ext)) {
-                mz_zip_archive_file_stat stat{};
-                mz_zip_reader_file_stat(&zip_ar, index, &stat);
-                std::vector<u8> data(stat.m_uncomp_size);
-                mz_zip_reader_extract_to_mem(&zip_ar, index, data.data(), data.size(), 0);
-                func(std::move(data));
+        // Blobs are decompressed in parallel a batch at a time, the callback runs on this thread.
+        const auto entries = pack.Collect(type);
+        const u32 num_workers =
+            std::clamp(std::thread::hardware_concurrency(), 1U, MAX_READ_WORKERS);
+        std::vector<std::vector<u8>> batch{};
+        for (size_t base = 0; base < entries.size(); base += READ_BATCH_SIZE) {
+            const size_t count = std::min(READ_BATCH_SIZE, entries.size() - base);
+            batch.assign(count, {});
+            std::atomic<size_t> next{};
+            {
+                std::vector<std::jthread> workers{};
+                for (u32 i = 0; i < num_workers; ++i) {
+                    workers.emplace_back([&] {
+                        for (size_t j = next++; j < count; j = next++) {
+                            batch[j] = pack.Read(entries[base + j]);
+                        }
+                    });
+                }
+            }
+            for (auto& data : batch) {
+                if (!data.empty()) {
+                    func(std::move(data));
+                }
             }
         }
     } else {
@@ -254,11 +657,14 @@ void DataBase::ForEachBlob(BlobType type, const std::function<void(std::vector<u
     }
 }
 
-void DataBase::FinishPreload() {
-    if (Config::isPipelineCacheArchived()) {
-        mz_zip_writer_init_from_reader(&zip_ar, cache_path.string().c_str());
-        ar_is_read_only = false;
-    }
+u32 DataBase::RegisterCloseCallback(std::function<void()>&& func) {
+    const u32 handle = next_callback_handle++;
+    close_callbacks.emplace_back(handle, std::move(func));
+    return handle;
+}
+
+void DataBase::UnregisterCloseCallback(u32 handle) {
+    std::erase_if(close_callbacks, [handle](const auto& entry) { return entry.first == handle; });
 }
 
 } // namespace Storage
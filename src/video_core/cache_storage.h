@@ -9,6 +9,7 @@
 
 #include <functional>
 #include <thread>
+#include <utility>
 #include <vector>
 
 namespace Storage {
@@ -18,6 +19,7 @@ enum class BlobType : u32 {
     ShaderBinary,
     PipelineKey,
     ShaderProfile,
+    PipelineUsage,
 };
 
 class DataBase {
@@ -31,7 +33,6 @@ public:
     [[nodiscard]] bool IsOpened() const {
         return opened;
     }
-    void FinishPreload();
 
     bool Save(BlobType type, const std::string& name, std::vector<u8>&& data);
     bool Save(BlobType type, const std::string& name, std::vector<u32>&& data);
@@ -41,8 +42,15 @@ public:
 
     void ForEachBlob(BlobType type, const std::function<void(std::vector<u8>&& data)>& func);
 
+    /// Registers a function to run before the database is closed, e.g. to save session data.
+    /// Returns a handle to unregister it with, in case its owner goes away first.
+    u32 RegisterCloseCallback(std::function<void()>&& func);
+    void UnregisterCloseCallback(u32 handle);
+
 private:
     std::jthread io_worker{};
+    std::vector<std::pair<u32, std::function<void()>>> close_callbacks{};
+    u32 next_callback_handle{};
     std::filesystem::path cache_path{};
     bool opened{};
 };
@@ -107,6 +107,15 @@ public:
                          VertexInputs<AmdGpu::Buffer>& guest_buffers, u32 step_rate_0,
                          u32 step_rate_1) const;
 
+    /// Fills the serialization data that depends on the guest state, so the pipeline can later
+    /// be built as if it was preloaded.
+    static void PrepareSerializationSupport(
+        const Instance& instance, const GraphicsPipelineKey& key,
+        std::span<const Shader::Info*, MaxShaderStages> infos,
+        std::span<const Shader::RuntimeInfo, MaxShaderStages> runtime_infos,
+        const std::optional<const Shader::Gcn::FetchShaderData>& fetch_shader,
+        SerializationSupport& sdata);
+
 private:
     void BuildDescSetLayout(bool preloading);
 
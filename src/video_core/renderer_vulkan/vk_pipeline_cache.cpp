@@ -7,8 +7,10 @@
 #include "common/hash.h"
 #include "common/io_file.h"
 #include "common/path_util.h"
+#include "common/thread.h"
 #include "core/debug_state.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/capture.h"
 #include "shader_recompiler/info.h"
 #include "shader_recompiler/recompiler.h"
 #include "shader_recompiler/runtime_info.h"
@@ -273,67 +275,241 @@ PipelineCache::PipelineCache(const Instance& instance_, Scheduler& scheduler_,
         .needs_clip_distance_emulation = instance.GetDriverID() == vk::DriverId::eNvidiaProprietary,
     };
 
-    WarmUp();
-
     auto [cache_result, cache] = instance.GetDevice().createPipelineCacheUnique({});
     ASSERT_MSG(cache_result == vk::Result::eSuccess, "Failed to create pipeline cache: {}",
                vk::to_string(cache_result));
     pipeline_cache = std::move(cache);
+
+    WarmUp();
+
+    if (Config::isAsyncPipelineCompileEnabled()) {
+        const u32 num_workers = std::max(std::thread::hardware_concurrency() / 4, 1U);
+        for (u32 i = 0; i < num_workers; ++i) {
+            compile_workers.emplace_back([this, i](std::stop_token stop_token) {
+                Common::SetCurrentThreadName(fmt::format("shadPS4:PipelineCompile{}", i).c_str());
+                CompileWorker(stop_token);
+            });
+        }
+    }
 }
 
-PipelineCache::~PipelineCache() = default;
+PipelineCache::~PipelineCache() {
+    if (usage_callback) {
+        Storage::DataBase::Instance().UnregisterCloseCallback(*usage_callback);
+        SavePipelineUsage();
+    }
+}
 
 const GraphicsPipeline* PipelineCache::GetGraphicsPipeline() {
+    if (has_streamed_pipelines.load(std::memory_order_acquire)) {
+        PublishStreamedPipelines();
+    }
     if (!RefreshGraphicsKey()) {
         return nullptr;
     }
-    const auto [it, is_new] = graphics_pipelines.try_emplace(graphics_key);
-    if (is_new) {
+    GraphicsPipeline* pipeline{};
+    if (const auto it = graphics_pipelines.find(graphics_key); it != graphics_pipelines.end()) {
+        pipeline = it->second.get();
+    } else if (compile_workers.empty()) {
+        pipeline = CompileGraphicsPipeline();
+    } else {
+        pipeline = GetAsyncGraphicsPipeline();
+        if (!pipeline) {
+            return nullptr;
+        }
+    }
+    pipeline->RecordUse(boot_time);
+    return pipeline;
+}
+
+void PipelineCache::PublishStreamedPipelines() {
+    std::scoped_lock lk{cache_mutex};
+    has_streamed_pipelines.store(false, std::memory_order_relaxed);
+    for (auto& [key, pipeline] : streamed_graphics_pipelines) {
+        // The pipeline may have been compiled at runtime while this one was streamed in.
+        graphics_pipelines.try_emplace(key, std::move(pipeline));
+    }
+    for (auto& [key, pipeline] : streamed_compute_pipelines) {
+        compute_pipelines.try_emplace(key, std::move(pipeline));
+    }
+    streamed_graphics_pipelines.clear();
+    streamed_compute_pipelines.clear();
+
+    // The streamer shares its shaders between its workers, they are only handed over once it is
+    // done. Duplicates of shaders the game compiled meanwhile are kept alive for the streamed
+    // pipelines that use them.
+    if (is_streaming) {
+        return;
+    }
+    for (auto it = streamed_programs.begin(); it != streamed_programs.end(); ++it) {
+        auto& program = it.value();
+        if (program_cache.contains(it->first)) {
+            retired_programs.emplace_back(std::move(program));
+        } else {
+            program_cache.emplace(it->first, std::move(program));
+        }
+    }
+    streamed_programs.clear();
+}
+
+GraphicsPipeline* PipelineCache::CompileGraphicsPipeline() {
+    const auto pipeline_hash = std::hash<GraphicsPipelineKey>{}(graphics_key);
+    LOG_INFO(Render_Vulkan, "Compiling graphics pipeline {:#x}", pipeline_hash);
+
+    GraphicsPipeline::SerializationSupport sdata{};
+    auto pipeline = std::make_unique<GraphicsPipeline>(
+        instance, scheduler, desc_heap, profile, graphics_key, *pipeline_cache, infos,
+        runtime_infos, fetch_shader, modules, sdata, false);
+    fetch_shader.reset();
+    return PublishGraphicsPipeline(std::move(pipeline), sdata, infos, modules);
+}
+
+GraphicsPipeline* PipelineCache::GetAsyncGraphicsPipeline() {
+    std::shared_ptr<PendingGraphicsPipeline> pending;
+    if (const auto it = pending_graphics_pipelines.find(graphics_key);
+        it != pending_graphics_pipelines.end()) {
+        pending = it->second;
+    } else {
+        PublishReadyPipelines();
+
         const auto pipeline_hash = std::hash<GraphicsPipelineKey>{}(graphics_key);
-        LOG_INFO(Render_Vulkan, "Compiling graphics pipeline {:#x}", pipeline_hash);
-
-        GraphicsPipeline::SerializationSupport sdata{};
-        it.value() = std::make_unique<GraphicsPipeline>(
-            instance, scheduler, desc_heap, profile, graphics_key, *pipeline_cache, infos,
-            runtime_infos, fetch_shader, modules, sdata, false);
-
-        RegisterPipelineData(graphics_key, pipeline_hash, sdata);
-        ++num_new_pipelines;
-
-        if (Config::collectShadersForDebug()) {
-            for (auto stage = 0; stage < MaxShaderStages; ++stage) {
-                if (infos[stage]) {
-                    auto& m = modules[stage];
-                    module_related_pipelines[m].emplace_back(graphics_key);
-                }
+        LOG_INFO(Render_Vulkan, "Queueing graphics pipeline {:#x}", pipeline_hash);
+
+        // Everything that reads guest state is captured here, the workers only touch Vulkan.
+        pending = std::make_shared<PendingGraphicsPipeline>();
+        pending->key = graphics_key;
+        pending->infos = infos;
+        pending->runtime_infos = runtime_infos;
+        pending->modules = modules;
+        pending->fetch_shader = fetch_shader;
+        pending->queued_frame = DebugState.GetFrameNum();
+        GraphicsPipeline::PrepareSerializationSupport(instance, graphics_key, infos,
+                                                      runtime_infos, fetch_shader, pending->sdata);
+        fetch_shader.reset();
+        pending_graphics_pipelines.emplace(graphics_key, pending);
+        {
+            std::scoped_lock lk{compile_mutex};
+            compile_queue.push_back(pending);
+        }
+        compile_cv.notify_one();
+    }
+
+    if (!pending->is_ready.load(std::memory_order_acquire)) {
+        const u32 skipped_frames = DebugState.GetFrameNum() - pending->queued_frame;
+        if (skipped_frames < Config::getAsyncPipelineSkipFrames()) {
+            return nullptr;
+        }
+        // The draw has been skipped for long enough, build the pipeline here unless a worker
+        // already started on it.
+        if (!pending->is_taken.exchange(true)) {
+            BuildPendingPipeline(*pending);
+        } else {
+            pending->is_ready.wait(false, std::memory_order_acquire);
+        }
+    }
+    pending_graphics_pipelines.erase(graphics_key);
+    return PublishGraphicsPipeline(std::move(pending->pipeline), pending->sdata, pending->infos,
+                                   pending->modules);
+}
+
+GraphicsPipeline* PipelineCache::PublishGraphicsPipeline(
+    std::unique_ptr<GraphicsPipeline> pipeline, GraphicsPipeline::SerializationSupport& sdata,
+    const std::array<const Shader::Info*, MaxShaderStages>& stage_infos,
+    const std::array<vk::ShaderModule, MaxShaderStages>& stage_modules) {
+    const auto key = pipeline->GetGraphicsKey();
+    RegisterPipelineData(key, std::hash<GraphicsPipelineKey>{}(key), sdata);
+    ++num_new_pipelines;
+
+    std::scoped_lock lk{cache_mutex};
+    if (Config::collectShadersForDebug()) {
+        for (auto stage = 0; stage < MaxShaderStages; ++stage) {
+            if (stage_infos[stage]) {
+                auto& m = stage_modules[stage];
+                module_related_pipelines[m].emplace_back(key);
             }
         }
-        fetch_shader.reset();
     }
+    const auto [it, _] = graphics_pipelines.try_emplace(key, std::move(pipeline));
     return it->second.get();
 }
 
+void PipelineCache::PublishReadyPipelines() {
+    // Pipelines that finished building but have not been drawn with since are moved into the
+    // cache here, otherwise they would linger in the pending map until their key comes back.
+    for (auto it = pending_graphics_pipelines.begin(); it != pending_graphics_pipelines.end();) {
+        auto& pending = *it->second;
+        if (!pending.is_ready.load(std::memory_order_acquire)) {
+            ++it;
+            continue;
+        }
+        if (!graphics_pipelines.contains(pending.key)) {
+            PublishGraphicsPipeline(std::move(pending.pipeline), pending.sdata, pending.infos,
+                                    pending.modules);
+        }
+        it = pending_graphics_pipelines.erase(it);
+    }
+}
+
+void PipelineCache::BuildPendingPipeline(PendingGraphicsPipeline& pending) {
+    pending.pipeline = std::make_unique<GraphicsPipeline>(
+        instance, scheduler, desc_heap, profile, pending.key, *pipeline_cache, pending.infos,
+        pending.runtime_infos, pending.fetch_shader, pending.modules, pending.sdata, true);
+    pending.is_ready.store(true, std::memory_order_release);
+    pending.is_ready.notify_all();
+}
+
+void PipelineCache::CompileWorker(std::stop_token stop_token) {
+    while (!stop_token.stop_requested()) {
+        std::shared_ptr<PendingGraphicsPipeline> pending;
+        {
+            std::unique_lock lk{compile_mutex};
+            if (!compile_cv.wait(lk, stop_token, [this] { return !compile_queue.empty(); })) {
+                return;
+            }
+            pending = std::move(compile_queue.front());
+            compile_queue.pop_front();
+        }
+        // The render thread may have given up waiting and built the pipeline itself.
+        if (!pending->is_taken.exchange(true)) {
+            BuildPendingPipeline(*pending);
+        }
+    }
+}
+
 const ComputePipeline* PipelineCache::GetComputePipeline() {
+    if (has_streamed_pipelines.load(std::memory_order_acquire)) {
+        PublishStreamedPipelines();
+    }
     if (!RefreshComputeKey()) {
         return nullptr;
     }
-    const auto [it, is_new] = compute_pipelines.try_emplace(compute_key);
-    if (is_new) {
-        const auto pipeline_hash = std::hash<ComputePipelineKey>{}(compute_key);
-        LOG_INFO(Render_Vulkan, "Compiling compute pipeline {:#x}", pipeline_hash);
+    ComputePipeline* pipeline{};
+    if (const auto it = compute_pipelines.find(compute_key); it != compute_pipelines.end()) {
+        pipeline = it->second.get();
+    } else {
+        pipeline = CompileComputePipeline();
+    }
+    pipeline->RecordUse(boot_time);
+    return pipeline;
+}
 
-        ComputePipeline::SerializationSupport sdata{};
-        it.value() = std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile,
-                                                       *pipeline_cache, compute_key, *infos[0],
-                                                       modules[0], sdata, false);
-        RegisterPipelineData(compute_key, sdata);
-        ++num_new_pipelines;
+ComputePipeline* PipelineCache::CompileComputePipeline() {
+    const auto pipeline_hash = std::hash<ComputePipelineKey>{}(compute_key);
+    LOG_INFO(Render_Vulkan, "Compiling compute pipeline {:#x}", pipeline_hash);
 
-        if (Config::collectShadersForDebug()) {
-            auto& m = modules[0];
-            module_related_pipelines[m].emplace_back(compute_key);
-        }
+    ComputePipeline::SerializationSupport sdata{};
+    auto pipeline =
+        std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile, *pipeline_cache,
+                                          compute_key, *infos[0], modules[0], sdata, false);
+    RegisterPipelineData(compute_key, sdata);
+    ++num_new_pipelines;
+
+    std::scoped_lock lk{cache_mutex};
+    if (Config::collectShadersForDebug()) {
+        auto& m = modules[0];
+        module_related_pipelines[m].emplace_back(compute_key);
     }
+    const auto [it, _] = compute_pipelines.try_emplace(compute_key, std::move(pipeline));
     return it->second.get();
 }
 
@@ -547,7 +723,11 @@ vk::ShaderModule PipelineCache::CompileModule(Shader::Info& info, Shader::Runtim
              perm_idx != 0 ? "(permutation)" : "");
     DumpShader(code, info.pgm_hash, info.stage, perm_idx, "bin");
 
-    const auto ir_program = Shader::TranslateProgram(code, pools, info, runtime_info, profile);
+    const bool collect_shader = Config::collectShadersForDebug();
+    std::vector<Shader::PassTiming> pass_timings;
+    const auto ir_program = Shader::TranslateProgram(code, pools, info, runtime_info, profile,
+                                                     collect_shader ? &pass_timings : nullptr);
+    DumpShaderCapture(info, code, runtime_info, binding, perm_idx);
     auto spv = Shader::Backend::SPIRV::EmitSPIRV(profile, runtime_info, ir_program, binding);
     DumpShader(spv, info.pgm_hash, info.stage, perm_idx, "spv");
 
@@ -566,9 +746,10 @@ vk::ShaderModule PipelineCache::CompileModule(Shader::Info& info, Shader::Runtim
 
     const auto name = GetShaderName(info.stage, info.pgm_hash, perm_idx);
     Vulkan::SetObjectName(instance.GetDevice(), module, name);
-    if (Config::collectShadersForDebug()) {
+    if (collect_shader) {
         DebugState.CollectShader(name, info.l_stage, module, spv, code,
-                                 patch ? *patch : std::span<const u32>{}, is_patched);
+                                 patch ? *patch : std::span<const u32>{}, std::move(pass_timings),
+                                 is_patched);
     }
     return module;
 }
@@ -623,6 +804,7 @@ PipelineCache::Result PipelineCache::GetProgram(Stage stage, LogicalStage l_stag
 
 std::optional<vk::ShaderModule> PipelineCache::ReplaceShader(vk::ShaderModule module,
                                                              std::span<const u32> spv_code) {
+    std::scoped_lock lk{cache_mutex};
     std::optional<vk::ShaderModule> new_module{};
     for (const auto& [_, program] : program_cache) {
         for (auto& m : program->modules) {
@@ -673,6 +855,29 @@ void PipelineCache::DumpShader(std::span<const u32> code, u64 hash, Shader::Stag
     file.WriteSpan(code);
 }
 
+void PipelineCache::DumpShaderCapture(const Shader::Info& info, std::span<const u32> code,
+                                      const Shader::RuntimeInfo& runtime_info,
+                                      const Shader::Backend::Bindings& binding, size_t perm_idx) {
+    if (!Config::dumpShaders()) {
+        return;
+    }
+
+    const auto capture =
+        Shader::ShaderCapture::Create(info, code, runtime_info, profile, binding, perm_idx);
+    if (!capture) {
+        return;
+    }
+
+    using namespace Common::FS;
+    const auto dump_dir = GetUserPath(PathType::ShaderDir) / "dumps";
+    if (!std::filesystem::exists(dump_dir)) {
+        std::filesystem::create_directories(dump_dir);
+    }
+    const auto filename = fmt::format("{}.{}", GetShaderName(info.stage, info.pgm_hash, perm_idx),
+                                      Shader::ShaderCapture::Extension);
+    capture->Save(dump_dir / filename);
+}
+
 std::optional<std::vector<u32>> PipelineCache::GetShaderPatch(u64 hash, Shader::Stage stage,
                                                               size_t perm_idx,
                                                               std::string_view ext) {
@@ -3,8 +3,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <variant>
 #include <tsl/robin_map.h>
+#include "common/serdes.h"
 #include "shader_recompiler/profile.h"
 #include "shader_recompiler/recompiler.h"
 #include "shader_recompiler/specialization.h"
@@ -23,10 +31,6 @@ namespace AmdGpu {
 class Liverpool;
 }
 
-namespace Serialization {
-struct Archive;
-}
-
 namespace Shader {
 struct Info;
 }
@@ -72,9 +76,8 @@ public:
     void WarmUp();
     void Sync();
 
-    bool LoadComputePipeline(Serialization::Archive& ar);
-    bool LoadGraphicsPipeline(Serialization::Archive& ar);
-    bool LoadPipelineStage(Serialization::Archive& ar, size_t stage);
+    bool LoadComputePipeline(const ComputePipelineKey& key, Serialization::Archive& ar);
+    bool LoadGraphicsPipeline(const GraphicsPipelineKey& key, Serialization::Archive& ar);
 
     const GraphicsPipeline* GetGraphicsPipeline();
 
@@ -96,12 +99,67 @@ public:
     }
 
 private:
+    using PipelineKey = std::variant<GraphicsPipelineKey, ComputePipelineKey>;
+
+    struct PipelineUsage {
+        u32 num_uses;
+        u32 first_use_ms;
+    };
+
+    struct PreloadEntry {
+        PipelineKey key;
+        Serialization::Archive ar;
+        u64 hash;
+        PipelineUsage usage;
+    };
+
+    struct PreloadStages {
+        std::array<const Shader::Info*, MaxShaderStages> infos{};
+        std::array<vk::ShaderModule, MaxShaderStages> modules{};
+        std::optional<Shader::Gcn::FetchShaderData> fetch_shader{};
+    };
+
+    /// Graphics pipeline handed to the compile workers, published once is_ready is set.
+    struct PendingGraphicsPipeline {
+        GraphicsPipelineKey key;
+        std::array<const Shader::Info*, MaxShaderStages> infos;
+        std::array<Shader::RuntimeInfo, MaxShaderStages> runtime_infos;
+        std::array<vk::ShaderModule, MaxShaderStages> modules;
+        std::optional<Shader::Gcn::FetchShaderData> fetch_shader;
+        GraphicsPipeline::SerializationSupport sdata;
+        std::unique_ptr<GraphicsPipeline> pipeline;
+        u32 queued_frame;
+        std::atomic_bool is_taken;
+        std::atomic_bool is_ready;
+    };
+
+    bool LoadPipelineStage(Serialization::Archive& ar, size_t stage, PreloadStages& stages);
+    u32 PreloadPipelines(std::span<PreloadEntry> entries, u32 num_workers,
+                         std::stop_token stop_token = {});
+    void LoadPipelineUsage();
+    void SavePipelineUsage();
+
+    void PublishStreamedPipelines();
+    GraphicsPipeline* CompileGraphicsPipeline();
+    ComputePipeline* CompileComputePipeline();
+    GraphicsPipeline* GetAsyncGraphicsPipeline();
+    GraphicsPipeline* PublishGraphicsPipeline(
+        std::unique_ptr<GraphicsPipeline> pipeline, GraphicsPipeline::SerializationSupport& sdata,
+        const std::array<const Shader::Info*, MaxShaderStages>& stage_infos,
+        const std::array<vk::ShaderModule, MaxShaderStages>& stage_modules);
+    void PublishReadyPipelines();
+    void BuildPendingPipeline(PendingGraphicsPipeline& pending);
+    void CompileWorker(std::stop_token stop_token);
+
     bool RefreshGraphicsKey();
     bool RefreshGraphicsStages();
     bool RefreshComputeKey();
 
     void DumpShader(std::span<const u32> code, u64 hash, Shader::Stage stage, size_t perm_idx,
                     std::string_view ext);
+    void DumpShaderCapture(const Shader::Info& info, std::span<const u32> code,
+                           const Shader::RuntimeInfo& runtime_info,
+                           const Shader::Backend::Bindings& binding, size_t perm_idx);
     std::optional<std::vector<u32>> GetShaderPatch(u64 hash, Shader::Stage stage, size_t perm_idx,
                                                    std::string_view ext);
     vk::ShaderModule CompileModule(Shader::Info& info, Shader::RuntimeInfo& runtime_info,
@@ -134,9 +192,33 @@ private:
     u32 num_new_pipelines{}; // new pipelines added to the cache since the game start
 
     // Only if Config::collectShadersForDebug()
-    tsl::robin_map<vk::ShaderModule,
-                   std::vector<std::variant<GraphicsPipelineKey, ComputePipelineKey>>>
-        module_related_pipelines;
+    tsl::robin_map<vk::ShaderModule, std::vector<PipelineKey>> module_related_pipelines;
+
+    std::chrono::steady_clock::time_point boot_time{std::chrono::steady_clock::now()};
+    tsl::robin_map<u64, PipelineUsage> pipeline_usage;
+    std::vector<PreloadEntry> streamed_pipelines;
+    std::mutex cache_mutex; ///< Guards changes to the caches and the streaming handoff below
+    std::atomic_bool is_streaming{};
+    std::optional<u32> usage_callback{};
+
+    // The render thread looks pipelines up without locking, the streamer leaves what it loads
+    // here and the render thread moves it into the caches.
+    tsl::robin_map<size_t, std::unique_ptr<Program>> streamed_programs;
+    std::vector<std::unique_ptr<Program>> retired_programs;
+    std::vector<std::pair<GraphicsPipelineKey, std::unique_ptr<GraphicsPipeline>>>
+        streamed_graphics_pipelines;
+    std::vector<std::pair<ComputePipelineKey, std::unique_ptr<ComputePipeline>>>
+        streamed_compute_pipelines;
+    std::atomic_bool has_streamed_pipelines{};
+    std::jthread stream_thread;
+
+    // Only if Config::isAsyncPipelineCompileEnabled()
+    tsl::robin_map<GraphicsPipelineKey, std::shared_ptr<PendingGraphicsPipeline>>
+        pending_graphics_pipelines;
+    std::deque<std::shared_ptr<PendingGraphicsPipeline>> compile_queue;
+    std::mutex compile_mutex;
+    std::condition_variable_any compile_cv;
+    std::vector<std::jthread> compile_workers;
 };
 
 } // namespace Vulkan
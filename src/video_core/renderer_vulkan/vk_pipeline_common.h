@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+
 #include "shader_recompiler/profile.h"
 #include "shader_recompiler/runtime_info.h"
 #include "video_core/renderer_vulkan/vk_common.h"
@@ -57,6 +60,26 @@ public:
         return is_compute;
     }
 
+    /// Records a bind of the pipeline. Usage is saved to order the warm-up on the next boot.
+    /// Only the render thread binds pipelines, so plain relaxed stores are enough here.
+    void RecordUse(std::chrono::steady_clock::time_point epoch) {
+        const u64 uses = num_uses.load(std::memory_order_relaxed);
+        if (uses == 0) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - epoch);
+            first_use_ms.store(static_cast<u32>(elapsed.count()), std::memory_order_relaxed);
+        }
+        num_uses.store(uses + 1, std::memory_order_relaxed);
+    }
+
+    u64 NumUses() const {
+        return num_uses.load(std::memory_order_relaxed);
+    }
+
+    u32 FirstUseMs() const {
+        return first_use_ms.load(std::memory_order_relaxed);
+    }
+
     using DescriptorWrites = boost::container::small_vector<vk::WriteDescriptorSet, 16>;
     using BufferBarriers = boost::container::small_vector<vk::BufferMemoryBarrier2, 16>;
 
@@ -76,6 +99,8 @@ protected:
     std::array<const Shader::Info*, Shader::MaxStageTypes> stages{};
     bool uses_push_descriptors{};
     bool is_compute;
+    std::atomic<u64> num_uses{};
+    std::atomic<u32> first_use_ms{};
 };
 
 } // namespace Vulkan
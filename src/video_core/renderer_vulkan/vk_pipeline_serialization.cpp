@@ -1,8 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <limits>
+
 #include "common/config.h"
 #include "common/serdes.h"
+#include "common/thread.h"
 #include "shader_recompiler/frontend/fetch_shader.h"
 #include "shader_recompiler/info.h"
 #include "video_core/cache_storage.h"
@@ -15,10 +19,14 @@ namespace Serialization {
 static constexpr u32 ShaderBinaryVersion = 1u;
 static constexpr u32 ShaderMetaVersion = 1u;
 static constexpr u32 PipelineKeyVersion = 1u;
+static constexpr u32 PipelineUsageVersion = 1u;
 } // namespace Serialization
 
 namespace Vulkan {
 
+// Pipelines first used within this time on the previous boot are built before the game starts.
+static constexpr u32 WarmUpPriorityWindowMs = 20'000;
+
 void RegisterPipelineData(const ComputePipelineKey& key,
                           ComputePipeline::SerializationSupport& sdata) {
     if (!Storage::DataBase::Instance().IsOpened()) {
@@ -140,35 +148,36 @@ bool ComputePipeline::SerializationSupport::Deserialize(Serialization::Archive&
     return true;
 }
 
-bool PipelineCache::LoadComputePipeline(Serialization::Archive& ar) {
-    compute_key.Deserialize(ar);
-
+bool PipelineCache::LoadComputePipeline(const ComputePipelineKey& key,
+                                        Serialization::Archive& ar) {
     ComputePipeline::SerializationSupport sdata{};
     sdata.Deserialize(ar);
 
     std::vector<u8> meta_blob;
     Storage::DataBase::Instance().Load(Storage::BlobType::ShaderMeta,
-                                       fmt::format("{:#018x}", compute_key.value), meta_blob);
+                                       fmt::format("{:#018x}", key.value), meta_blob);
     if (meta_blob.empty()) {
         return false;
     }
 
     Serialization::Archive meta_ar{std::move(meta_blob)};
 
-    if (!LoadPipelineStage(meta_ar, 0)) {
+    PreloadStages stages{};
+    if (!LoadPipelineStage(meta_ar, 0, stages)) {
         return false;
     }
 
-    const auto [it, is_new] = compute_pipelines.try_emplace(compute_key);
-    ASSERT(is_new);
-
-    it.value() =
+    auto pipeline =
         std::make_unique<ComputePipeline>(instance, scheduler, desc_heap, profile, *pipeline_cache,
-                                          compute_key, *infos[0], modules[0], sdata, true);
-
-    infos.fill(nullptr);
-    modules.fill(nullptr);
+                                          key, *stages.infos[0], stages.modules[0], sdata, true);
 
+    std::scoped_lock lk{cache_mutex};
+    if (is_streaming) {
+        streamed_compute_pipelines.emplace_back(key, std::move(pipeline));
+        has_streamed_pipelines.store(true, std::memory_order_release);
+    } else {
+        compute_pipelines.try_emplace(key, std::move(pipeline));
+    }
     return true;
 }
 
@@ -208,14 +217,14 @@ bool GraphicsPipeline::SerializationSupport::Deserialize(Serialization::Archive&
     return true;
 }
 
-bool PipelineCache::LoadGraphicsPipeline(Serialization::Archive& ar) {
-    graphics_key.Deserialize(ar);
-
+bool PipelineCache::LoadGraphicsPipeline(const GraphicsPipelineKey& key,
+                                         Serialization::Archive& ar) {
     GraphicsPipeline::SerializationSupport sdata{};
     sdata.Deserialize(ar);
 
+    PreloadStages stages{};
     for (int stage_idx = 0; stage_idx < MaxShaderStages; ++stage_idx) {
-        const auto& hash = graphics_key.stage_hashes[stage_idx];
+        const auto& hash = key.stage_hashes[stage_idx];
         if (!hash) {
             continue;
         }
@@ -229,31 +238,32 @@ bool PipelineCache::LoadGraphicsPipeline(Serialization::Archive& ar) {
 
         Serialization::Archive meta_ar{std::move(meta_blob)};
 
-        if (!LoadPipelineStage(meta_ar, stage_idx)) {
+        if (!LoadPipelineStage(meta_ar, stage_idx, stages)) {
             return false;
         }
     }
 
-    const auto [it, is_new] = graphics_pipelines.try_emplace(graphics_key);
-    ASSERT(is_new);
-
-    it.value() = std::make_unique<GraphicsPipeline>(
-        instance, scheduler, desc_heap, profile, graphics_key, *pipeline_cache, infos,
-        runtime_infos, fetch_shader, modules, sdata, true);
-
-    infos.fill(nullptr);
-    modules.fill(nullptr);
-    fetch_shader.reset();
+    auto pipeline = std::make_unique<GraphicsPipeline>(
+        instance, scheduler, desc_heap, profile, key, *pipeline_cache, stages.infos,
+        runtime_infos, stages.fetch_shader, stages.modules, sdata, true);
 
+    std::scoped_lock lk{cache_mutex};
+    if (is_streaming) {
+        streamed_graphics_pipelines.emplace_back(key, std::move(pipeline));
+        has_streamed_pipelines.store(true, std::memory_order_release);
+    } else {
+        graphics_pipelines.try_emplace(key, std::move(pipeline));
+    }
     return true;
 }
 
-bool PipelineCache::LoadPipelineStage(Serialization::Archive& ar, size_t stage) {
+bool PipelineCache::LoadPipelineStage(Serialization::Archive& ar, size_t stage,
+                                      PreloadStages& stages) {
     auto program = std::make_unique<Program>();
     Shader::StageSpecialization spec{};
     spec.info = &program->info;
     size_t perm_idx{};
-    if (!LoadShaderMeta(ar, program->info, fetch_shader, spec, perm_idx)) {
+    if (!LoadShaderMeta(ar, program->info, stages.fetch_shader, spec, perm_idx)) {
         return false;
     }
 
@@ -265,48 +275,180 @@ bool PipelineCache::LoadPipelineStage(Serialization::Archive& ar, size_t stage)
         return false;
     }
 
-    // Permutation hash depends on shader variation index. To prevent collisions, we need insert it
-    // at the exact position rather than append
+    // Streamed shaders are kept apart until the render thread takes them over, see
+    // PublishStreamedPipelines.
+    auto& programs = is_streaming ? streamed_programs : program_cache;
+    const auto find_module = [&] -> std::optional<vk::ShaderModule> {
+        const auto it_pgm = programs.find(program->info.pgm_hash);
+        if (it_pgm == programs.end()) {
+            return std::nullopt;
+        }
+        const auto& modules = it_pgm->second->modules;
+        const auto it = std::ranges::find(modules, spec, &Program::Module::spec);
+        if (it == modules.end()) {
+            return std::nullopt;
+        }
+        // If the permutation is already preloaded, make sure it has the same permutation index.
+        const auto idx = std::distance(modules.begin(), it);
+        ASSERT_MSG(perm_idx == idx, "Permutation {} is already inserted at {}! ({}_{:x})", perm_idx,
+                   idx, program->info.stage, program->info.pgm_hash);
+        stages.infos[stage] = &it_pgm->second->info;
+        return it->module;
+    };
+
+    {
+        std::scoped_lock lk{cache_mutex};
+        if (const auto module = find_module()) {
+            stages.modules[stage] = *module;
+            return true;
+        }
+    }
 
-    vk::ShaderModule module{};
+    // The module is created without holding the lock. If another worker inserted the same
+    // permutation in the meantime, its module is used and this one is dropped.
+    const auto module = CompileSPV(spv, instance.GetDevice());
+
+    std::scoped_lock lk{cache_mutex};
+    if (const auto existing = find_module()) {
+        instance.GetDevice().destroyShaderModule(module);
+        stages.modules[stage] = *existing;
+        return true;
+    }
 
-    auto [it_pgm, new_program] = program_cache.try_emplace(program->info.pgm_hash);
+    // Permutation hash depends on shader variation index. To prevent collisions, we need insert it
+    // at the exact position rather than append
+    auto [it_pgm, new_program] = programs.try_emplace(program->info.pgm_hash);
     if (new_program) {
-        module = CompileSPV(spv, instance.GetDevice());
         it_pgm.value() = std::move(program);
+        it_pgm.value()->InsertPermut(module, std::move(spec), perm_idx);
     } else {
-        const auto& it = std::ranges::find(it_pgm.value()->modules, spec, &Program::Module::spec);
-        if (it != it_pgm.value()->modules.end()) {
-            // If the permutation is already preloaded, make sure it has the same permutation index
-            const auto idx = std::distance(it_pgm.value()->modules.begin(), it);
-            ASSERT_MSG(perm_idx == idx, "Permutation {} is already inserted at {}! ({}_{:x})",
-                       perm_idx, idx, program->info.stage, program->info.pgm_hash);
-            module = it->module;
+        auto& modules = it_pgm.value()->modules;
+        if (perm_idx < modules.size() && modules[perm_idx].module) {
+            it_pgm.value()->AddPermut(module, std::move(spec));
         } else {
-            module = CompileSPV(spv, instance.GetDevice());
+            it_pgm.value()->InsertPermut(module, std::move(spec), perm_idx);
         }
     }
-    it_pgm.value()->InsertPermut(module, std::move(spec), perm_idx);
 
-    infos[stage] = &it_pgm.value()->info;
-    modules[stage] = module;
+    stages.infos[stage] = &it_pgm.value()->info;
+    stages.modules[stage] = module;
 
     return true;
 }
 
+u32 PipelineCache::PreloadPipelines(std::span<PreloadEntry> entries, u32 num_workers,
+                                    std::stop_token stop_token) {
+    std::atomic<size_t> next_entry{};
+    std::atomic<u32> num_loaded{};
+    const auto worker = [&] {
+        for (size_t i = next_entry++; i < entries.size(); i = next_entry++) {
+            if (stop_token.stop_requested()) {
+                break;
+            }
+            auto& entry = entries[i];
+            const bool result = std::visit(
+                [&](const auto& key) {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(key)>, ComputePipelineKey>) {
+                        return LoadComputePipeline(key, entry.ar);
+                    } else {
+                        return LoadGraphicsPipeline(key, entry.ar);
+                    }
+                },
+                entry.key);
+            if (result) {
+                ++num_loaded;
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers{};
+        for (u32 i = 1; i < num_workers; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+    }
+    return num_loaded;
+}
+
+void PipelineCache::LoadPipelineUsage() {
+    std::vector<u8> usage_data{};
+    Storage::DataBase::Instance().Load(Storage::BlobType::PipelineUsage, "usage", usage_data);
+    if (usage_data.empty()) {
+        return;
+    }
+
+    Serialization::Archive ar{std::move(usage_data)};
+    Serialization::Reader usage{ar};
+
+    u32 version{};
+    usage.Read(version);
+    if (version != Serialization::PipelineUsageVersion) {
+        return;
+    }
+
+    size_t num_entries{};
+    usage.Read(num_entries);
+    pipeline_usage.reserve(num_entries);
+    for (size_t i = 0; i < num_entries; ++i) {
+        u64 hash{};
+        PipelineUsage entry{};
+        usage.Read(hash);
+        usage.Read(entry);
+        pipeline_usage[hash] = entry;
+    }
+}
+
+void PipelineCache::SavePipelineUsage() {
+    // Make sure the streaming threads are done with the database before it is closed.
+    stream_thread = {};
+    std::scoped_lock lk{cache_mutex};
+
+    const auto update_usage = [&](u64 hash, const Pipeline& pipeline) {
+        if (!pipeline.NumUses()) {
+            return;
+        }
+        // Counts accumulate over boots, the first use time is the one of the latest boot.
+        auto& entry = pipeline_usage[hash];
+        const u64 num_uses = u64(entry.num_uses) + pipeline.NumUses();
+        entry.num_uses = static_cast<u32>(std::min<u64>(num_uses, std::numeric_limits<u32>::max()));
+        entry.first_use_ms = pipeline.FirstUseMs();
+    };
+    for (const auto& [key, pipeline] : graphics_pipelines) {
+        update_usage(std::hash<GraphicsPipelineKey>{}(key), *pipeline);
+    }
+    for (const auto& [key, pipeline] : compute_pipelines) {
+        update_usage(key.value, *pipeline);
+    }
+
+    Serialization::Archive ar{};
+    Serialization::Writer usage{ar};
+
+    usage.Write(Serialization::PipelineUsageVersion);
+    usage.Write(pipeline_usage.size());
+    for (const auto& [hash, entry] : pipeline_usage) {
+        usage.Write(hash);
+        usage.Write(entry);
+    }
+
+    Storage::DataBase::Instance().Save(Storage::BlobType::PipelineUsage, "usage", ar.TakeOff());
+}
+
 void PipelineCache::WarmUp() {
     if (!Config::isPipelineCacheEnabled()) {
         return;
     }
 
     Storage::DataBase::Instance().Open();
+    usage_callback = Storage::DataBase::Instance().RegisterCloseCallback([this] {
+        usage_callback.reset();
+        SavePipelineUsage();
+    });
 
     // Check if cache is compatible
     std::vector<u8> profile_data{};
     Storage::DataBase::Instance().Load(Storage::BlobType::ShaderProfile, "profile", profile_data);
     if (profile_data.empty()) {
-        Storage::DataBase::Instance().FinishPreload();
-
         profile_data.resize(sizeof(profile));
         std::memcpy(profile_data.data(), &profile, sizeof(profile));
         Storage::DataBase::Instance().Save(Storage::BlobType::ShaderProfile, "profile",
@@ -319,8 +461,10 @@ void PipelineCache::WarmUp() {
         return;
     }
 
-    u32 num_pipelines{};
+    LoadPipelineUsage();
+
     u32 num_total_pipelines{};
+    std::vector<PreloadEntry> entries{};
 
     Storage::DataBase::Instance().ForEachBlob(
         Storage::BlobType::PipelineKey, [&](std::vector<u8>&& data) {
@@ -338,25 +482,74 @@ void PipelineCache::WarmUp() {
             u32 is_compute{};
             pldata.Read(is_compute);
 
-            bool result{};
+            u64 hash{};
+            PipelineKey key{};
             if (is_compute) {
-                result = LoadComputePipeline(ar);
+                auto& compute_key = key.emplace<ComputePipelineKey>();
+                compute_key.Deserialize(ar);
+                hash = compute_key.value;
             } else {
-                result = LoadGraphicsPipeline(ar);
+                auto& graphics_key = key.emplace<GraphicsPipelineKey>();
+                graphics_key.Deserialize(ar);
+                hash = std::hash<GraphicsPipelineKey>{}(graphics_key);
             }
 
-            if (result) {
-                ++num_pipelines;
-            }
+            const auto it = pipeline_usage.find(hash);
+            const auto usage = it != pipeline_usage.end()
+                                   ? it->second
+                                   : PipelineUsage{0, std::numeric_limits<u32>::max()};
+            entries.emplace_back(key, std::move(ar), hash, usage);
         });
 
+    // Pipelines the game needed first on the previous boot are built first, the ones that were
+    // never used go last.
+    std::ranges::stable_sort(entries, [](const PreloadEntry& lhs, const PreloadEntry& rhs) {
+        if (lhs.usage.first_use_ms != rhs.usage.first_use_ms) {
+            return lhs.usage.first_use_ms < rhs.usage.first_use_ms;
+        }
+        return lhs.usage.num_uses > rhs.usage.num_uses;
+    });
+
+    // Without usage data there is no telling which pipelines are needed early, build them all.
+    const size_t num_priority =
+        pipeline_usage.empty()
+            ? entries.size()
+            : static_cast<size_t>(std::ranges::count_if(entries, [](const PreloadEntry& entry) {
+                  return entry.usage.first_use_ms <= WarmUpPriorityWindowMs;
+              }));
+
+    const u32 num_workers = std::max(std::thread::hardware_concurrency(), 1U);
+    const u32 num_pipelines =
+        PreloadPipelines(std::span{entries}.first(num_priority), num_workers);
+
     LOG_INFO(Render, "Preloaded {} pipelines", num_pipelines);
-    if (num_total_pipelines > num_pipelines) {
+    const u32 num_stale = num_total_pipelines - entries.size() + num_priority - num_pipelines;
+    if (num_stale > 0) {
         LOG_WARNING(Render, "{} stale pipelines were found. Consider re-generating the cache",
-                    num_total_pipelines - num_pipelines);
+                    num_stale);
+    }
+    if (num_priority == entries.size()) {
+        return;
     }
 
-    Storage::DataBase::Instance().FinishPreload();
+    // Stream the rest in the background with part of the cores while the game starts up.
+    entries.erase(entries.begin(), entries.begin() + num_priority);
+    streamed_pipelines = std::move(entries);
+    is_streaming = true;
+    stream_thread = std::jthread{[this, num_workers](std::stop_token stop_token) {
+        Common::SetCurrentThreadName("shadPS4:PipelineStream");
+        const u32 num_streamed =
+            PreloadPipelines(streamed_pipelines, std::max(num_workers / 2, 1U), stop_token);
+        {
+            // Let the render thread take over the streamed shaders as well.
+            std::scoped_lock lk{cache_mutex};
+            is_streaming = false;
+            has_streamed_pipelines.store(true, std::memory_order_release);
+        }
+        LOG_INFO(Render, "Streamed {} of {} pipelines in the background", num_streamed,
+                 streamed_pipelines.size());
+        streamed_pipelines.clear();
+    }};
 }
 
 void PipelineCache::Sync() {
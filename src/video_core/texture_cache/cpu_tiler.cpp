@@ -0,0 +1,583 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <type_traits>
+
+#include "common/assert.h"
+#include "video_core/texture_cache/cpu_tiler.h"
+#include "video_core/texture_cache/image_info.h"
+
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+
+namespace VideoCore {
+
+static constexpr u32 MICRO_TILE_WIDTH = 8;
+static constexpr u32 MICRO_TILE_HEIGHT = 8;
+static constexpr u32 MICRO_TILE_PIXELS = MICRO_TILE_WIDTH * MICRO_TILE_HEIGHT;
+static constexpr u32 NUM_PIPE_INTERLEAVE_BITS = 8;
+static constexpr u32 SHUFFLE_LANE_BYTES = 16;
+
+static constexpr u32 Bit(u32 value, u32 bit) {
+    return (value >> bit) & 1;
+}
+
+static constexpr bool Is3DTiled(AmdGpu::ArrayMode array_mode) {
+    return array_mode == AmdGpu::ArrayMode::Array3DTiledThin1 ||
+           array_mode == AmdGpu::ArrayMode::Array3DTiledThick ||
+           array_mode == AmdGpu::ArrayMode::Array3DTiledXThick;
+}
+
+static constexpr bool Is2DTiled(AmdGpu::ArrayMode array_mode) {
+    return array_mode == AmdGpu::ArrayMode::Array2DTiledThin1 ||
+           array_mode == AmdGpu::ArrayMode::Array2DTiledThick ||
+           array_mode == AmdGpu::ArrayMode::Array2DTiledXThick;
+}
+
+static constexpr bool HasTileSplitRotation(AmdGpu::ArrayMode array_mode) {
+    return array_mode == AmdGpu::ArrayMode::Array2DTiledThin1 ||
+           array_mode == AmdGpu::ArrayMode::Array3DTiledThin1 ||
+           array_mode == AmdGpu::ArrayMode::ArrayPrt2DTiledThin1 ||
+           array_mode == AmdGpu::ArrayMode::ArrayPrt3DTiledThin1;
+}
+
+CpuTiler::CpuTiler(const ImageInfo& info)
+    : num_bits{info.num_bits}, num_bytes{info.num_bits / 8}, num_samples{info.num_samples},
+      array_mode{info.array_mode}, bank_swizzle{info.bank_swizzle},
+      num_mips{std::max<u32>(info.resources.levels, 1)} {
+    ASSERT_MSG(IsSupported(info), "Unsupported tiling {} for {} bpp",
+               AmdGpu::NameOf(info.tile_mode), info.num_bits);
+
+    const auto& tiling = AmdGpu::GetTilingDescriptor(info.tile_mode, num_bits, num_samples);
+    micro_tile_mode = tiling.micro_tile_mode;
+    thickness = tiling.micro_tile_thickness;
+    is_macro_tiled = tiling.is_macro_tiled;
+    micro_tile_bytes = MICRO_TILE_PIXELS * thickness * num_bits * num_samples / 8;
+    if (is_macro_tiled) {
+        pipe_config = tiling.pipe_config;
+        num_pipes = tiling.num_pipes;
+        num_pipe_bits = std::bit_width(num_pipes) - 1;
+        bank_width = tiling.bank_width;
+        bank_height = tiling.bank_height;
+        num_banks = tiling.num_banks;
+        num_bank_bits = std::bit_width(num_banks) - 1;
+        tile_split_bytes = tiling.tile_split;
+        macro_tile_aspect = tiling.macro_tile_aspect;
+        if (micro_tile_bytes > tile_split_bytes && thickness == 1) {
+            num_tile_splits = micro_tile_bytes / tile_split_bytes;
+        }
+    }
+
+    for (u32 mip = 0; mip < num_mips; ++mip) {
+        const auto& mip_info = info.mips_layout[mip];
+        mips[mip] = {mip_info.size, mip_info.pitch, mip_info.height, mip_info.offset};
+        if (info.props.is_block) {
+            mips[mip].pitch = std::max((mip_info.pitch + 3) / 4, 1U);
+            mips[mip].height = std::max((mip_info.height + 3) / 4, 1U);
+        }
+    }
+
+    // Every micro tile shares the same pixel arrangement, so precompute the offset of each pixel
+    // from the tile base. The tile base itself only depends on the tile coordinates.
+    pixel_offsets.resize(MICRO_TILE_PIXELS * thickness);
+    for (u32 z = 0; z < thickness; ++z) {
+        for (u32 y = 0; y < MICRO_TILE_HEIGHT; ++y) {
+            for (u32 x = 0; x < MICRO_TILE_WIDTH; ++x) {
+                const u32 index = (z * MICRO_TILE_HEIGHT + y) * MICRO_TILE_WIDTH + x;
+                u32 element_offset = ElementOffset(PixelIndex(x, y, z));
+                if (num_tile_splits > 1) {
+                    element_offset %= tile_split_bytes;
+                }
+                pixel_offsets[index] = InterleaveOffset(element_offset);
+                max_pixel_offset = std::max(max_pixel_offset, pixel_offsets[index]);
+            }
+        }
+    }
+
+    BuildShuffleTables();
+}
+
+bool CpuTiler::IsSupported(const ImageInfo& info) {
+    if (!info.props.is_tiled || info.resources.levels > 16 || info.num_samples > 8) {
+        return false;
+    }
+    switch (info.num_bits) {
+    case 8:
+    case 16:
+    case 32:
+    case 64:
+    case 128:
+        break;
+    default:
+        return false;
+    }
+    switch (info.array_mode) {
+    case AmdGpu::ArrayMode::ArrayLinearGeneral:
+    case AmdGpu::ArrayMode::ArrayLinearAligned:
+        return false;
+    default:
+        return true;
+    }
+}
+
+u32 CpuTiler::PixelIndex(u32 x, u32 y, u32 z) const {
+    const u32 x0 = Bit(x, 0), x1 = Bit(x, 1), x2 = Bit(x, 2);
+    const u32 y0 = Bit(y, 0), y1 = Bit(y, 1), y2 = Bit(y, 2);
+    const u32 z0 = Bit(z, 0), z1 = Bit(z, 1), z2 = Bit(z, 2);
+    std::array<u32, 9> p{};
+
+    switch (micro_tile_mode) {
+    case AmdGpu::MicroTileMode::Display:
+        switch (num_bits) {
+        case 8:
+            p = {x0, x1, x2, y1, y0, y2};
+            break;
+        case 16:
+            p = {x0, x1, x2, y0, y1, y2};
+            break;
+        case 32:
+            p = {x0, x1, y0, x2, y1, y2};
+            break;
+        case 64:
+            p = {x0, y0, x1, x2, y1, y2};
+            break;
+        case 128:
+            p = {y0, x0, x1, x2, y1, y2};
+            break;
+        }
+        break;
+    case AmdGpu::MicroTileMode::Thin:
+    case AmdGpu::MicroTileMode::Depth:
+        p = {x0, y0, x1, y1, x2, y2};
+        break;
+    default:
+        switch (num_bits) {
+        case 8:
+        case 16:
+            p = {x0, y0, x1, y1, z0, z1};
+            break;
+        case 32:
+            p = {x0, y0, x1, z0, y1, z1};
+            break;
+        case 64:
+        case 128:
+            p = {x0, y0, z0, x1, y1, z1};
+            break;
+        }
+        p[6] = x2;
+        p[7] = y2;
+        if (thickness == 8) {
+            p[8] = z2;
+        }
+        break;
+    }
+
+    u32 pixel_number = 0;
+    for (u32 i = 0; i < p.size(); ++i) {
+        pixel_number |= p[i] << i;
+    }
+    return pixel_number;
+}
+
+u32 CpuTiler::ElementOffset(u32 pixel_index) const {
+    // Only the first sample is transferred, so the sample offset is always zero.
+    if (micro_tile_mode == AmdGpu::MicroTileMode::Depth) {
+        return pixel_index * num_bits * num_samples / 8;
+    }
+    return pixel_index * num_bits / 8;
+}
+
+u32 CpuTiler::InterleaveOffset(u32 element_offset) const {
+    if (!is_macro_tiled) {
+        return element_offset;
+    }
+    constexpr u32 pipe_interleave_mask = (1U << NUM_PIPE_INTERLEAVE_BITS) - 1;
+    const u32 offset_shift = NUM_PIPE_INTERLEAVE_BITS + num_pipe_bits + num_bank_bits;
+    return (element_offset & pipe_interleave_mask) |
+           ((element_offset >> NUM_PIPE_INTERLEAVE_BITS) << offset_shift);
+}
+
+u32 CpuTiler::PipeFromCoord(u32 x, u32 y, u32 slice) const {
+    const u32 tx = x / MICRO_TILE_WIDTH;
+    const u32 ty = y / MICRO_TILE_HEIGHT;
+    const u32 x3 = Bit(tx, 0), x4 = Bit(tx, 1), x5 = Bit(tx, 2);
+    const u32 y3 = Bit(ty, 0), y4 = Bit(ty, 1), y5 = Bit(ty, 2);
+
+    u32 pipe = 0;
+    switch (pipe_config) {
+    case AmdGpu::PipeConfig::P2:
+        pipe = x3 ^ y3;
+        break;
+    case AmdGpu::PipeConfig::P8_32x32_8x16:
+        pipe = (x4 ^ y3 ^ x5) | ((x3 ^ y4) << 1) | ((x5 ^ y5) << 2);
+        break;
+    case AmdGpu::PipeConfig::P8_32x32_16x16:
+        pipe = (x3 ^ y3 ^ x4) | ((x4 ^ y4) << 1) | ((x5 ^ y5) << 2);
+        break;
+    default:
+        break;
+    }
+
+    u32 pipe_swizzle = 0;
+    if (Is3DTiled(array_mode)) {
+        pipe_swizzle += std::max(1U, num_pipes / 2 - 1) * (slice / thickness);
+    }
+    pipe_swizzle &= num_pipes - 1;
+    return pipe ^ pipe_swizzle;
+}
+
+u32 CpuTiler::BankFromCoord(u32 x, u32 y, u32 slice, u32 tile_split_slice) const {
+    const u32 tx = x / MICRO_TILE_WIDTH / (bank_width * num_pipes);
+    const u32 ty = y / MICRO_TILE_HEIGHT / bank_height;
+    const u32 x3 = Bit(tx, 0), x4 = Bit(tx, 1), x5 = Bit(tx, 2), x6 = Bit(tx, 3);
+    const u32 y3 = Bit(ty, 0), y4 = Bit(ty, 1), y5 = Bit(ty, 2), y6 = Bit(ty, 3);
+
+    u32 bank = 0;
+    switch (num_banks) {
+    case 16:
+        bank = (x3 ^ y6) | ((x4 ^ y5 ^ y6) << 1) | ((x5 ^ y4) << 2) | ((x6 ^ y3) << 3);
+        break;
+    case 8:
+        bank = (x3 ^ y5) | ((x4 ^ y4 ^ y5) << 1) | ((x5 ^ y3) << 2);
+        break;
+    case 4:
+        bank = (x3 ^ y4) | ((x4 ^ y3) << 1);
+        break;
+    case 2:
+        bank = x3 ^ y3;
+        break;
+    }
+
+    u32 slice_rotation = 0;
+    if (Is2DTiled(array_mode)) {
+        slice_rotation = (num_banks / 2 - 1) * (slice / thickness);
+    } else if (Is3DTiled(array_mode)) {
+        slice_rotation = std::max(1U, num_pipes / 2 - 1) * (slice / thickness) / num_pipes;
+    }
+    u32 tile_split_rotation = 0;
+    if (HasTileSplitRotation(array_mode)) {
+        tile_split_rotation = (num_banks / 2 + 1) * tile_split_slice;
+    }
+
+    bank ^= bank_swizzle + slice_rotation;
+    bank ^= tile_split_rotation;
+    return bank & (num_banks - 1);
+}
+
+u32 CpuTiler::TileBase(u32 x, u32 y, u32 slice, u32 pitch, u32 height,
+                       u32 tile_split_slice) const {
+    if (!is_macro_tiled) {
+        const u32 slice_bytes = (pitch * height * thickness * num_bits * num_samples + 7) / 8;
+        const u32 micro_tiles_per_row = pitch / MICRO_TILE_WIDTH;
+        const u32 micro_tile_index =
+            (y / MICRO_TILE_HEIGHT) * micro_tiles_per_row + x / MICRO_TILE_WIDTH;
+        return (slice / thickness) * slice_bytes + micro_tile_index * micro_tile_bytes;
+    }
+
+    const u32 tile_bytes = num_tile_splits > 1 ? tile_split_bytes : micro_tile_bytes;
+    const u32 macro_tile_pitch = MICRO_TILE_WIDTH * bank_width * num_pipes * macro_tile_aspect;
+    const u32 macro_tile_height = MICRO_TILE_HEIGHT * bank_height * num_banks / macro_tile_aspect;
+    const u32 macro_tile_bytes = tile_bytes * (macro_tile_pitch / MICRO_TILE_WIDTH) *
+                                 (macro_tile_height / MICRO_TILE_HEIGHT) / (num_pipes * num_banks);
+
+    const u32 macro_tiles_per_row = pitch / macro_tile_pitch;
+    const u32 macro_tile_index =
+        (y / macro_tile_height) * macro_tiles_per_row + x / macro_tile_pitch;
+    const u32 macro_tile_offset = macro_tile_index * macro_tile_bytes;
+    const u32 macro_tiles_per_slice = macro_tiles_per_row * (height / macro_tile_height);
+    const u32 slice_bytes = macro_tiles_per_slice * macro_tile_bytes;
+    const u32 slice_offset =
+        slice_bytes * (tile_split_slice + num_tile_splits * (slice / thickness));
+
+    const u32 tile_row_index = (y / MICRO_TILE_HEIGHT) % bank_height;
+    const u32 tile_column_index = (x / MICRO_TILE_WIDTH / num_pipes) % bank_width;
+    const u32 tile_offset = (tile_row_index * bank_width + tile_column_index) * tile_bytes;
+    const u32 total_offset = slice_offset + macro_tile_offset + tile_offset;
+
+    if (AmdGpu::IsPrt(array_mode)) {
+        x %= macro_tile_pitch;
+        y %= macro_tile_height;
+    }
+
+    const u32 pipe = PipeFromCoord(x, y, slice);
+    const u32 bank = BankFromCoord(x, y, slice, tile_split_slice);
+
+    constexpr u32 pipe_interleave_mask = (1U << NUM_PIPE_INTERLEAVE_BITS) - 1;
+    const u32 offset = total_offset >> NUM_PIPE_INTERLEAVE_BITS;
+    return (total_offset & pipe_interleave_mask) | (pipe << NUM_PIPE_INTERLEAVE_BITS) |
+           (bank << (NUM_PIPE_INTERLEAVE_BITS + num_pipe_bits)) |
+           (offset << (NUM_PIPE_INTERLEAVE_BITS + num_pipe_bits + num_bank_bits));
+}
+
+u32 CpuTiler::TiledOffset(u32 mip, u32 x, u32 y, u32 slice) const {
+    const auto& mip_info = mips[mip];
+    u32 element_offset = ElementOffset(PixelIndex(x, y, slice));
+    u32 tile_split_slice = 0;
+    if (num_tile_splits > 1) {
+        tile_split_slice = element_offset / tile_split_bytes;
+        element_offset %= tile_split_bytes;
+    }
+    // Tile bases are aligned to the (split) micro tile size, so adding the interleaved element
+    // offset is equivalent to interleaving the full surface offset.
+    return mip_info.offset +
+           TileBase(x, y, slice, mip_info.pitch, mip_info.height, tile_split_slice) +
+           InterleaveOffset(element_offset);
+}
+
+void CpuTiler::BuildShuffleTables() {
+    // Micro tiles of 8 and 16bpp thin surfaces occupy 64 or 128 contiguous bytes, so they can be
+    // permuted in registers instead of being moved one texel at a time.
+    const u32 window_bytes = MICRO_TILE_PIXELS * num_bytes;
+    if (num_bytes > 2 || thickness != 1 || num_tile_splits != 1 ||
+        max_pixel_offset + num_bytes > window_bytes) {
+        return;
+    }
+
+    std::array<u8, MICRO_TILE_PIXELS * 2> covered{};
+    for (u32 pixel = 0; pixel < MICRO_TILE_PIXELS; ++pixel) {
+        for (u32 byte = 0; byte < num_bytes; ++byte) {
+            covered[pixel_offsets[pixel] + byte]++;
+        }
+    }
+    for (u32 i = 0; i < window_bytes; ++i) {
+        if (covered[i] != 1) {
+            return;
+        }
+    }
+
+    for (auto* table : {&detile_shuffle, &tile_shuffle}) {
+        for (auto& mask : table->masks) {
+            mask.fill(0x80);
+        }
+        table->sources.fill(0);
+    }
+    for (u32 pixel = 0; pixel < MICRO_TILE_PIXELS; ++pixel) {
+        for (u32 byte = 0; byte < num_bytes; ++byte) {
+            const u32 linear = pixel * num_bytes + byte;
+            const u32 tiled = pixel_offsets[pixel] + byte;
+            const auto add = [](ShuffleTable& table, u32 dst, u32 src) {
+                const u32 dst_lane = dst / SHUFFLE_LANE_BYTES;
+                const u32 src_lane = src / SHUFFLE_LANE_BYTES;
+                table.masks[dst_lane * 8 + src_lane][dst % SHUFFLE_LANE_BYTES] =
+                    static_cast<u8>(src % SHUFFLE_LANE_BYTES);
+                table.sources[dst_lane] |= 1U << src_lane;
+            };
+            add(detile_shuffle, linear, tiled);
+            add(tile_shuffle, tiled, linear);
+        }
+    }
+#ifdef __SSSE3__
+    use_shuffle = true;
+#endif
+}
+
+template <u32 Bytes, bool IsTiler>
+void CpuTiler::ProcessTile(TiledPtr<IsTiler> tiled, LinearPtr<IsTiler> linear, u32 linear_pitch,
+                           u32 micro_z) const {
+    const u32* offsets = pixel_offsets.data() + micro_z * MICRO_TILE_PIXELS;
+
+#ifdef __SSSE3__
+    if constexpr (Bytes <= 2) {
+        if (use_shuffle) {
+            constexpr u32 num_lanes = MICRO_TILE_PIXELS * Bytes / SHUFFLE_LANE_BYTES;
+            constexpr u32 rows_per_lane = SHUFFLE_LANE_BYTES / (MICRO_TILE_WIDTH * Bytes);
+            const auto& table = IsTiler ? tile_shuffle : detile_shuffle;
+
+            __m128i src[num_lanes];
+            for (u32 lane = 0; lane < num_lanes; ++lane) {
+                if constexpr (IsTiler) {
+                    const u8* row = linear + lane * rows_per_lane * linear_pitch;
+                    if constexpr (rows_per_lane == 2) {
+                        src[lane] = _mm_unpacklo_epi64(
+                            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row)),
+                            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(row + linear_pitch)));
+                    } else {
+                        src[lane] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+                    }
+                } else {
+                    src[lane] = _mm_loadu_si128(
+                        reinterpret_cast<const __m128i*>(tiled + lane * SHUFFLE_LANE_BYTES));
+                }
+            }
+
+            for (u32 lane = 0; lane < num_lanes; ++lane) {
+                __m128i result = _mm_setzero_si128();
+                for (u32 src_lane = 0; src_lane < num_lanes; ++src_lane) {
+                    if (table.sources[lane] & (1U << src_lane)) {
+                        const auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                            table.masks[lane * 8 + src_lane].data()));
+                        result = _mm_or_si128(result, _mm_shuffle_epi8(src[src_lane], mask));
+                    }
+                }
+                if constexpr (IsTiler) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(tiled + lane * SHUFFLE_LANE_BYTES),
+                                     result);
+                } else {
+                    u8* row = linear + lane * rows_per_lane * linear_pitch;
+                    if constexpr (rows_per_lane == 2) {
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(row), result);
+                        _mm_storel_epi64(reinterpret_cast<__m128i*>(row + linear_pitch),
+                                         _mm_unpackhi_epi64(result, result));
+                    } else {
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(row), result);
+                    }
+                }
+            }
+            return;
+        }
+    }
+#endif
+
+#ifdef __AVX2__
+    if constexpr (!IsTiler && Bytes == 4) {
+        for (u32 y = 0; y < MICRO_TILE_HEIGHT; ++y) {
+            const auto index =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(offsets + y * 8));
+            const auto texels =
+                _mm256_i32gather_epi32(reinterpret_cast<const int*>(tiled), index, 1);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(linear + y * linear_pitch), texels);
+        }
+        return;
+    }
+    if constexpr (!IsTiler && Bytes == 8) {
+        for (u32 y = 0; y < MICRO_TILE_HEIGHT; ++y) {
+            u8* row = linear + y * linear_pitch;
+            for (u32 half = 0; half < 2; ++half) {
+                const auto index =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(offsets + y * 8 + half * 4));
+                const auto texels =
+                    _mm256_i32gather_epi64(reinterpret_cast<const long long*>(tiled), index, 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + half * 32), texels);
+            }
+        }
+        return;
+    }
+#endif
+
+    for (u32 y = 0; y < MICRO_TILE_HEIGHT; ++y) {
+        for (u32 x = 0; x < MICRO_TILE_WIDTH; ++x) {
+            const u32 tiled_offset = offsets[y * MICRO_TILE_WIDTH + x];
+            const u32 linear_offset = y * linear_pitch + x * Bytes;
+            if constexpr (IsTiler) {
+                std::memcpy(tiled + tiled_offset, linear + linear_offset, Bytes);
+            } else {
+                std::memcpy(linear + linear_offset, tiled + tiled_offset, Bytes);
+            }
+        }
+    }
+}
+
+template <u32 Bytes, bool IsTiler>
+void CpuTiler::Process(TiledPtr<IsTiler> tiled, size_t tiled_size, LinearPtr<IsTiler> linear,
+                       size_t linear_size) const {
+    size_t linear_texel = 0;
+    for (u32 mip = 0; mip < num_mips; ++mip) {
+        const auto& mip_info = mips[mip];
+        const u32 num_texels = mip_info.size / Bytes;
+        const u32 slice_texels = mip_info.pitch * mip_info.height;
+        ASSERT_MSG((linear_texel + num_texels) * Bytes <= linear_size,
+                   "Linear buffer too small for mip {}", mip);
+        const auto linear_mip = linear + linear_texel * Bytes;
+        linear_texel += num_texels;
+        if (slice_texels == 0) {
+            continue;
+        }
+
+        // Texels outside of whole micro tiles are handled individually.
+        const auto process_texels = [&](u32 begin, u32 end) {
+            for (u32 texel = begin; texel < end; ++texel) {
+                const u32 x = texel % mip_info.pitch;
+                const u32 y = (texel / mip_info.pitch) % mip_info.height;
+                const u32 slice = texel / slice_texels;
+                const u32 tiled_offset = TiledOffset(mip, x, y, slice);
+                const auto linear_ptr = linear_mip + size_t(texel) * Bytes;
+                if (tiled_offset + Bytes > tiled_size) {
+                    if constexpr (!IsTiler) {
+                        std::memset(linear_ptr, 0, Bytes);
+                    }
+                    continue;
+                }
+                if constexpr (IsTiler) {
+                    std::memcpy(tiled + tiled_offset, linear_ptr, Bytes);
+                } else {
+                    std::memcpy(linear_ptr, tiled + tiled_offset, Bytes);
+                }
+            }
+        };
+
+        const bool is_tile_aligned = mip_info.pitch % MICRO_TILE_WIDTH == 0 &&
+                                     mip_info.height % MICRO_TILE_HEIGHT == 0;
+        if (!is_tile_aligned || num_tile_splits > 1) {
+            process_texels(0, num_texels);
+            continue;
+        }
+
+        const u32 num_slices = num_texels / slice_texels;
+        const u32 linear_pitch = mip_info.pitch * Bytes;
+        const u32 tiles_x = mip_info.pitch / MICRO_TILE_WIDTH;
+        const u32 tiles_y = mip_info.height / MICRO_TILE_HEIGHT;
+        for (u32 slice = 0; slice < num_slices; ++slice) {
+            for (u32 tile_y = 0; tile_y < tiles_y; ++tile_y) {
+                for (u32 tile_x = 0; tile_x < tiles_x; ++tile_x) {
+                    const u32 x = tile_x * MICRO_TILE_WIDTH;
+                    const u32 y = tile_y * MICRO_TILE_HEIGHT;
+                    const u32 tile_base =
+                        mip_info.offset +
+                        TileBase(x, y, slice, mip_info.pitch, mip_info.height, 0);
+                    if (tile_base + max_pixel_offset + Bytes > tiled_size) {
+                        for (u32 row = 0; row < MICRO_TILE_HEIGHT; ++row) {
+                            const u32 texel =
+                                (slice * mip_info.height + y + row) * mip_info.pitch + x;
+                            process_texels(texel, texel + MICRO_TILE_WIDTH);
+                        }
+                        continue;
+                    }
+                    const auto linear_tile =
+                        linear_mip + ((size_t(slice) * mip_info.height + y) * mip_info.pitch + x) *
+                                         Bytes;
+                    ProcessTile<Bytes, IsTiler>(tiled + tile_base, linear_tile, linear_pitch,
+                                                slice % thickness);
+                }
+            }
+        }
+        process_texels(num_slices * slice_texels, num_texels);
+    }
+}
+
+void CpuTiler::Detile(std::span<const u8> tiled, std::span<u8> linear) const {
+    switch (num_bytes) {
+    case 1:
+        return Process<1, false>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 2:
+        return Process<2, false>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 4:
+        return Process<4, false>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 8:
+        return Process<8, false>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 16:
+        return Process<16, false>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    default:
+        UNREACHABLE_MSG("Unsupported bpp {}", num_bits);
+    }
+}
+
+void CpuTiler::Tile(std::span<const u8> linear, std::span<u8> tiled) const {
+    switch (num_bytes) {
+    case 1:
+        return Process<1, true>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 2:
+        return Process<2, true>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 4:
+        return Process<4, true>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 8:
+        return Process<8, true>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    case 16:
+        return Process<16, true>(tiled.data(), tiled.size(), linear.data(), linear.size());
+    default:
+        UNREACHABLE_MSG("Unsupported bpp {}", num_bits);
+    }
+}
+
+} // namespace VideoCore
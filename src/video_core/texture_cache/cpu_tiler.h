@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright 2025 shadPS4 Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "common/types.h"
+#include "video_core/amdgpu/tiling.h"
+
+namespace VideoCore {
+
+struct ImageInfo;
+
+/// Host implementation of the tiling compute shader. Converts an image between its GCN tiled
+/// guest layout and the linear layout used for uploads, producing bit-exact results with the GPU
+/// path so it can be used both for small transfers and as a reference for the shaders.
+class CpuTiler {
+public:
+    explicit CpuTiler(const ImageInfo& info);
+
+    /// Returns true if the image tiling parameters are supported by the CPU tiler.
+    static bool IsSupported(const ImageInfo& info);
+
+    /// Detiles the guest image data into the linear layout.
+    void Detile(std::span<const u8> tiled, std::span<u8> linear) const;
+
+    /// Tiles linear image data into the guest layout.
+    void Tile(std::span<const u8> linear, std::span<u8> tiled) const;
+
+    /// Returns the tiled byte offset of the texel at the provided coordinates of a mip level.
+    u32 TiledOffset(u32 mip, u32 x, u32 y, u32 slice) const;
+
+private:
+    struct MipLayout {
+        u32 size;
+        u32 pitch;
+        u32 height;
+        u32 offset;
+    };
+
+    struct ShuffleTable {
+        std::array<std::array<u8, 16>, 64> masks;
+        std::array<u8, 8> sources;
+    };
+
+    template <bool IsTiler>
+    using TiledPtr = std::conditional_t<IsTiler, u8*, const u8*>;
+    template <bool IsTiler>
+    using LinearPtr = std::conditional_t<IsTiler, const u8*, u8*>;
+
+    template <u32 Bytes, bool IsTiler>
+    void Process(TiledPtr<IsTiler> tiled, size_t tiled_size, LinearPtr<IsTiler> linear,
+                 size_t linear_size) const;
+
+    template <u32 Bytes, bool IsTiler>
+    void ProcessTile(TiledPtr<IsTiler> tiled, LinearPtr<IsTiler> linear, u32 linear_pitch,
+                     u32 micro_z) const;
+
+    u32 PixelIndex(u32 x, u32 y, u32 z) const;
+    u32 ElementOffset(u32 pixel_index) const;
+    u32 InterleaveOffset(u32 element_offset) const;
+    u32 TileBase(u32 x, u32 y, u32 slice, u32 pitch, u32 height, u32 tile_split_slice) const;
+    u32 PipeFromCoord(u32 x, u32 y, u32 slice) const;
+    u32 BankFromCoord(u32 x, u32 y, u32 slice, u32 tile_split_slice) const;
+    void BuildShuffleTables();
+
+    u32 num_bits;
+    u32 num_bytes;
+    u32 num_samples;
+    AmdGpu::ArrayMode array_mode;
+    AmdGpu::MicroTileMode micro_tile_mode;
+    u32 thickness;
+    bool is_macro_tiled;
+    u32 micro_tile_bytes;
+    u32 bank_swizzle;
+    u32 num_pipes{};
+    u32 num_pipe_bits{};
+    u32 bank_width{};
+    u32 bank_height{};
+    u32 num_banks{};
+    u32 num_bank_bits{};
+    u32 tile_split_bytes{};
+    u32 macro_tile_aspect{};
+    u32 num_tile_splits{1};
+    AmdGpu::PipeConfig pipe_config{};
+    u32 num_mips;
+    std::array<MipLayout, 16> mips{};
+
+    // Per pixel offsets inside a micro tile, indexed by [z][y][x], relative to the tile base.
+    std::vector<u32> pixel_offsets;
+    u32 max_pixel_offset{};
+
+    // Byte shuffles converting a whole micro tile between tiled and linear order.
+    bool use_shuffle{};
+    ShuffleTable detile_shuffle{};
+    ShuffleTable tile_shuffle{};
+};
+
+} // namespace VideoCore
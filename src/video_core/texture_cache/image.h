@@ -11,8 +11,11 @@
 
 #include <deque>
 #include <optional>
+#include <vector>
+#include <boost/container/flat_set.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/container/static_vector.hpp>
+#include <tsl/robin_map.h>
 
 namespace Vulkan {
 class Instance;
@@ -29,7 +32,8 @@ enum ImageFlagBits : u32 {
     MaybeCpuDirty = 1 << 0, ///< The page this image is in was touched before the image address
     CpuDirty = 1 << 1,      ///< Contents have been modified from the CPU
     GpuDirty = 1 << 2, ///< Contents have been modified from the GPU (valid data in buffer cache)
-    Dirty = MaybeCpuDirty | CpuDirty | GpuDirty,
+    CpuPagesDirty = 1 << 4, ///< Some pages of a large image have been modified from the CPU
+    Dirty = MaybeCpuDirty | CpuDirty | GpuDirty | CpuPagesDirty,
     GpuModified = 1 << 3, ///< Contents have been modified from the GPU
     Registered = 1 << 6,  ///< True when the image is registered
     Picked = 1 << 7,      ///< Temporary flag to mark the image as picked
@@ -167,6 +171,11 @@ public:
     std::deque<BackingImage> backing_images;
     BackingImage* backing{};
     boost::container::static_vector<u64, 16> mip_hashes{};
+    /// Pages of a large image written from the CPU since the last upload, indexed from the first
+    /// page of the image, with the hash of the image memory in each page before it was written.
+    tsl::robin_map<u32, u64> written_pages;
+    /// Written pages that no longer protect the image, while the rest of it stays tracked.
+    boost::container::flat_set<u32> untracked_pages;
     u64 lru_id{};
     u64 tick_accessed_last{};
     u64 hash{};
@@ -152,6 +152,10 @@ bool ImageInfo::IsCompatible(const ImageInfo& info) const {
 
 void ImageInfo::UpdateSize() {
     guest_size = 0;
+    const AmdGpu::TilingDescriptor* tiling = nullptr;
+    if (AmdGpu::IsMacroTiled(array_mode)) {
+        tiling = &AmdGpu::GetTilingDescriptor(tile_mode, num_bits, num_samples);
+    }
     for (s32 mip = 0; mip < resources.levels; ++mip) {
         u32 mip_w = pitch >> mip;
         u32 mip_h = size.height >> mip;
@@ -193,7 +197,7 @@ void ImageInfo::UpdateSize() {
         case AmdGpu::ArrayMode::Array2DTiledThin1: {
             ASSERT(!props.is_block);
             std::tie(mip_info.pitch, mip_info.height, mip_info.size) = ImageSizeMacroTiled(
-                mip_w, mip_h, thickness, num_bits, num_samples, tile_mode, mip, alt_tile);
+                mip_w, mip_h, thickness, num_bits, num_samples, *tiling, mip, alt_tile);
             break;
         }
         default: {
@@ -6,6 +6,7 @@
 #include "common/assert.h"
 #include "common/config.h"
 #include "common/debug.h"
+#include "common/div_ceil.h"
 #include "common/scope_exit.h"
 #include "core/memory.h"
 #include "video_core/buffer_cache/buffer_cache.h"
@@ -20,6 +21,43 @@ namespace VideoCore {
 
 static constexpr u64 PageShift = 12;
 static constexpr u64 NumFramesBeforeRemoval = 32;
+static constexpr u32 TRACK_PAGES_MIN_SIZE = 1_MB;
+
+/// Returns the address and size of the image memory that lies in the given page of the image.
+static std::pair<VAddr, u64> GetImagePageRange(const ImageInfo& info, u32 page) {
+    const VAddr image_end = info.guest_address + info.guest_size;
+    const VAddr page_addr =
+        PageManager::GetPageAddr(info.guest_address) + (VAddr(page) << PageManager::PAGE_BITS);
+    const VAddr begin = std::max(page_addr, info.guest_address);
+    return {begin, std::min(page_addr + PageManager::PAGE_SIZE, image_end) - begin};
+}
+
+/// Returns the height in pixels of the tile rows a mip level of the image is stored as, where each
+/// row spans the full pitch and is contiguous in guest memory, or zero if the layout has none.
+static u32 GetTileRowHeight(const ImageInfo& info) {
+    if (info.props.is_volume || info.num_samples > 1) {
+        return 0;
+    }
+    const u32 block_dim = info.props.is_block ? 4 : 1;
+    switch (info.array_mode) {
+    case AmdGpu::ArrayMode::ArrayLinearAligned:
+        return block_dim;
+    case AmdGpu::ArrayMode::Array1DTiledThin1:
+        return 8 * block_dim;
+    case AmdGpu::ArrayMode::Array2DTiledThin1: {
+        const auto& tiling =
+            AmdGpu::GetTilingDescriptor(info.tile_mode, info.num_bits, info.num_samples);
+        // Tile splits spread each macro tile over several planes of the slice.
+        const u32 micro_tile_bytes = 64 * info.num_bits / 8;
+        if (tiling.is_prt || micro_tile_bytes > tiling.tile_split) {
+            return 0;
+        }
+        return tiling.macro_tile_height[info.alt_tile] * block_dim;
+    }
+    default:
+        return 0;
+    }
+}
 
 TextureCache::TextureCache(const Vulkan::Instance& instance_, Vulkan::Scheduler& scheduler_,
                            AmdGpu::Liverpool* liverpool_, BufferCache& buffer_cache_,
@@ -146,7 +184,14 @@ void TextureCache::InvalidateMemory(VAddr addr, size_t size) {
     ForEachImageInRegion(pages_start, pages_end - pages_start, [&](ImageId image_id, Image& image) {
         const auto image_begin = image.info.guest_address;
         const auto image_end = image.info.guest_address + image.info.guest_size;
-        if (image.Overlaps(addr, size)) {
+        if (image.info.guest_size >= TRACK_PAGES_MIN_SIZE && image.IsTracked()) {
+            // Large images only unprotect the accessed pages and remember what they held, so
+            // that only the tile rows that really changed are uploaded again.
+            UntrackImagePages(image_id, pages_start, pages_end);
+            if (image.Overlaps(addr, size)) {
+                image.flags |= ImageFlagBits::CpuPagesDirty;
+            }
+        } else if (image.Overlaps(addr, size)) {
             // Modified region overlaps image, so the image was definitely accessed by this fault.
             // Untrack the image, so that the range is unprotected and the guest can write freely.
             image.flags |= ImageFlagBits::CpuDirty;
@@ -610,37 +655,12 @@ ImageView& TextureCache::FindDepthTarget(ImageId image_id, const ImageDesc& desc
     return image.FindView(desc.view_info, false);
 }
 
-void TextureCache::RefreshImage(Image& image) {
-    if (False(image.flags & ImageFlagBits::Dirty) || image.info.num_samples > 1) {
-        return;
-    }
-
-    RENDERER_TRACE;
-    TRACE_HINT(fmt::format("{:x}:{:x}", image.info.guest_address, image.info.guest_size));
-
-    if (True(image.flags & ImageFlagBits::MaybeCpuDirty) &&
-        False(image.flags & ImageFlagBits::CpuDirty)) {
-        // The image size should be less than page size to be considered MaybeCpuDirty
-        // So this calculation should be very uncommon and reasonably fast
-        // For now we'll just check up to 64 first pixels
-        const auto addr = std::bit_cast<u8*>(image.info.guest_address);
-        const u32 w = std::min(image.info.size.width, u32(8));
-        const u32 h = std::min(image.info.size.height, u32(8));
-        const u32 size = w * h * image.info.num_bits >> (3 + image.info.props.is_block ? 4 : 0);
-        const u64 hash = XXH3_64bits(addr, size);
-        if (image.hash == hash) {
-            image.flags &= ~ImageFlagBits::MaybeCpuDirty;
-            return;
-        }
-        image.hash = hash;
-    }
-
+void TextureCache::CollectMipCopies(Image& image, ImageCopies& image_copies) {
     const u32 num_layers = image.info.resources.layers;
     const u32 num_mips = image.info.resources.levels;
     const bool is_gpu_modified = True(image.flags & ImageFlagBits::GpuModified);
     const bool is_gpu_dirty = True(image.flags & ImageFlagBits::GpuDirty);
 
-    boost::container::small_vector<vk::BufferImageCopy, 14> image_copies;
     for (u32 m = 0; m < num_mips; m++) {
         const u32 width = std::max(image.info.size.width >> m, 1u);
         const u32 height = std::max(image.info.size.height >> m, 1u);
@@ -674,6 +694,151 @@ void TextureCache::RefreshImage(Image& image) {
             .imageExtent = {extent_width, extent_height, depth},
         });
     }
+}
+
+void TextureCache::CollectWrittenRows(Image& image, ImageCopies& image_copies,
+                                      ImageRanges& ranges) {
+    const auto& info = image.info;
+    boost::container::small_vector<std::pair<u64, u64>, 16> changed_pages;
+    for (const auto& [page, hash] : image.written_pages) {
+        const auto [addr, size] = GetImagePageRange(info, page);
+        if (XXH3_64bits(std::bit_cast<const u8*>(addr), size) != hash) {
+            const u64 offset = addr - info.guest_address;
+            changed_pages.emplace_back(offset, offset + size);
+        }
+    }
+    if (changed_pages.empty()) {
+        return;
+    }
+    std::ranges::sort(changed_pages);
+
+    const u32 num_layers = info.resources.layers;
+    const u32 num_mips = info.resources.levels;
+    const u32 block_dim = info.props.is_block ? 4 : 1;
+    const u32 row_height = GetTileRowHeight(info);
+    boost::container::small_vector<bool, 256> dirty_bands;
+    for (u32 m = 0; m < num_mips; m++) {
+        const u32 width = std::max(info.size.width >> m, 1u);
+        const u32 height = std::max(info.size.height >> m, 1u);
+        const u32 depth = info.props.is_volume ? std::max(info.size.depth >> m, 1u) : 1u;
+        const auto [mip_size, mip_pitch, mip_height, mip_offset] = info.mips_layout[m];
+        const u32 extent_width = mip_pitch ? std::min(mip_pitch, width) : width;
+        const u32 extent_height = mip_height ? std::min(mip_height, height) : height;
+
+        // Each band of tile rows is a contiguous run of every slice, unless the slice is padded.
+        const u64 slice_size = mip_size / num_layers;
+        const u64 row_bytes = u64(mip_pitch / block_dim) * (info.num_bits / 8);
+        const bool has_bands = row_height != 0 && mip_height % row_height == 0 &&
+                               slice_size == row_bytes * (mip_height / block_dim);
+        const u32 num_bands = has_bands ? mip_height / row_height : 1;
+        const u64 band_size = has_bands ? row_bytes * (row_height / block_dim) : slice_size;
+
+        dirty_bands.assign(num_bands, false);
+        for (u32 layer = 0; layer < num_layers; layer++) {
+            const u64 slice_begin = mip_offset + layer * slice_size;
+            const u64 slice_end = slice_begin + slice_size;
+            for (const auto& [page_begin, page_end] : changed_pages) {
+                if (page_begin >= slice_end) {
+                    break;
+                }
+                if (page_end <= slice_begin) {
+                    continue;
+                }
+                const u64 begin = std::max(page_begin, slice_begin);
+                const u64 end = std::min(page_end, slice_end);
+                const u64 first_band = (begin - slice_begin) / band_size;
+                const u64 last_band = Common::DivCeil(end - slice_begin, band_size);
+                std::fill(dirty_bands.begin() + first_band, dirty_bands.begin() + last_band, true);
+            }
+        }
+
+        for (u32 band = 0; band < num_bands;) {
+            if (!dirty_bands[band]) {
+                band++;
+                continue;
+            }
+            const u32 first_band = band;
+            while (band < num_bands && dirty_bands[band]) {
+                band++;
+            }
+            const u32 y = has_bands ? first_band * row_height : 0;
+            const u32 y_end =
+                has_bands ? std::min(band * row_height, extent_height) : extent_height;
+            if (y >= y_end) {
+                // Only padding rows changed.
+                continue;
+            }
+            image_copies.push_back({
+                .bufferOffset = mip_offset + (y / block_dim) * row_bytes,
+                .bufferRowLength = mip_pitch,
+                .bufferImageHeight = mip_height,
+                .imageSubresource{
+                    .aspectMask = image.aspect_mask & ~vk::ImageAspectFlagBits::eStencil,
+                    .mipLevel = m,
+                    .baseArrayLayer = 0,
+                    .layerCount = num_layers,
+                },
+                .imageOffset = {0, static_cast<s32>(y), 0},
+                .imageExtent = {extent_width, y_end - y, depth},
+            });
+
+            // The copy reads the rows from every slice, so all of them have to be in memory.
+            const u64 run_begin = first_band * band_size;
+            const u64 run_size = std::min<u64>(band * band_size, slice_size) - run_begin;
+            for (u32 layer = 0; layer < num_layers; layer++) {
+                const u32 offset = mip_offset + layer * slice_size + run_begin;
+                if (!ranges.empty() && ranges.back().first + ranges.back().second == offset) {
+                    ranges.back().second += run_size;
+                } else {
+                    ranges.emplace_back(offset, run_size);
+                }
+            }
+        }
+    }
+
+    // Whole mip hashes no longer describe what the image holds.
+    std::ranges::fill(image.mip_hashes, 0);
+}
+
+void TextureCache::RefreshImage(Image& image) {
+    if (False(image.flags & ImageFlagBits::Dirty) || image.info.num_samples > 1) {
+        return;
+    }
+
+    RENDERER_TRACE;
+    TRACE_HINT(fmt::format("{:x}:{:x}", image.info.guest_address, image.info.guest_size));
+
+    if (True(image.flags & ImageFlagBits::MaybeCpuDirty) &&
+        False(image.flags & ImageFlagBits::CpuDirty)) {
+        // The image size should be less than page size to be considered MaybeCpuDirty
+        // So this calculation should be very uncommon and reasonably fast
+        // For now we'll just check up to 64 first pixels
+        const auto addr = std::bit_cast<u8*>(image.info.guest_address);
+        const u32 w = std::min(image.info.size.width, u32(8));
+        const u32 h = std::min(image.info.size.height, u32(8));
+        const u32 size = w * h * image.info.num_bits >> (3 + image.info.props.is_block ? 4 : 0);
+        const u64 hash = XXH3_64bits(addr, size);
+        if (image.hash == hash) {
+            image.flags &= ~ImageFlagBits::MaybeCpuDirty;
+            return;
+        }
+        image.hash = hash;
+    }
+
+    // When only some pages of a large image were written, upload just the tile rows in them
+    // that changed. GPU dirty data lives in the buffer cache instead.
+    const bool use_written_pages =
+        False(image.flags & (ImageFlagBits::CpuDirty | ImageFlagBits::GpuDirty)) &&
+        !buffer_cache.IsRegionGpuModified(image.info.guest_address, image.info.guest_size);
+
+    ImageCopies image_copies;
+    ImageRanges ranges;
+    if (use_written_pages && !image.written_pages.empty()) {
+        CollectWrittenRows(image, image_copies, ranges);
+    } else {
+        CollectMipCopies(image, image_copies);
+    }
+    image.written_pages.clear();
 
     if (image_copies.empty()) {
         image.flags &= ~ImageFlagBits::Dirty;
@@ -682,8 +847,21 @@ void TextureCache::RefreshImage(Image& image) {
 
     scheduler.EndRendering();
 
+    // Small tiled images that are not GPU modified can be detiled directly from guest memory,
+    // skipping the scratch buffer allocation and compute dispatch.
+    if (TileManager::CanDetileOnCpu(image.info) &&
+        !buffer_cache.IsRegionGpuModified(image.info.guest_address, image.info.guest_size)) {
+        const auto [buffer, offset] = tile_manager.DetileImageCpu(
+            std::bit_cast<const u8*>(image.info.guest_address), image.info);
+        for (auto& copy : image_copies) {
+            copy.bufferOffset += offset;
+        }
+        image.Upload(image_copies, buffer, offset);
+        return;
+    }
+
     const auto [in_buffer, in_offset] =
-        buffer_cache.ObtainBufferForImage(image.info.guest_address, image.info.guest_size);
+        buffer_cache.ObtainBufferForImage(image.info.guest_address, image.info.guest_size, ranges);
     if (auto barrier = in_buffer->GetBarrier(vk::AccessFlagBits2::eTransferRead,
                                              vk::PipelineStageFlagBits2::eTransfer)) {
         scheduler.CommandBuffer().pipelineBarrier2(vk::DependencyInfo{
@@ -694,7 +872,7 @@ void TextureCache::RefreshImage(Image& image) {
     }
 
     const auto [buffer, offset] =
-        tile_manager.DetileImage(in_buffer->Handle(), in_offset, image.info);
+        tile_manager.DetileImage(in_buffer->Handle(), in_offset, image.info, ranges);
     for (auto& copy : image_copies) {
         copy.bufferOffset += offset;
     }
@@ -748,6 +926,13 @@ void TextureCache::TrackImage(ImageId image_id) {
     if (!(image.flags & ImageFlagBits::Registered)) {
         return;
     }
+    for (const u32 page : image.untracked_pages) {
+        // Protect the pages unprotected by writes again.
+        const auto [addr, size] = GetImagePageRange(image.info, page);
+        tracker.UpdatePageWatchers<1>(addr, size);
+    }
+    image.untracked_pages.clear();
+
     const auto image_begin = image.info.guest_address;
     const auto image_end = image.info.guest_address + image.info.guest_size;
     if (image_begin == image.track_addr && image_end == image.track_addr_end) {
@@ -805,11 +990,48 @@ void TextureCache::UntrackImage(ImageId image_id) {
     if (!image.IsTracked()) {
         return;
     }
-    const auto addr = image.track_addr;
-    const auto size = image.track_addr_end - image.track_addr;
+    auto addr = image.track_addr;
+    const auto addr_end = image.track_addr_end;
     image.track_addr = 0;
     image.track_addr_end = 0;
-    if (size != 0) {
+    for (const u32 page : image.untracked_pages) {
+        // Skip the pages that were already unprotected by writes.
+        const auto [page_addr, page_size] = GetImagePageRange(image.info, page);
+        if (addr < page_addr) {
+            tracker.UpdatePageWatchers<false>(addr, page_addr - addr);
+        }
+        addr = std::max(addr, page_addr + page_size);
+    }
+    image.untracked_pages.clear();
+    if (addr < addr_end) {
+        tracker.UpdatePageWatchers<false>(addr, addr_end - addr);
+    }
+}
+
+void TextureCache::UntrackImagePages(ImageId image_id, VAddr pages_start, VAddr pages_end) {
+    auto& image = slot_images[image_id];
+    const auto first_page = PageManager::GetPageAddr(image.info.guest_address);
+    const auto last_page =
+        PageManager::GetPageAddr(image.info.guest_address + image.info.guest_size - 1);
+    const u32 begin = (std::max(pages_start, first_page) - first_page) >> PageManager::PAGE_BITS;
+    const u32 end = (std::min(pages_end, last_page + PageManager::PAGE_SIZE) - first_page) >>
+                    PageManager::PAGE_BITS;
+    const u32 num_pages = ((last_page - first_page) >> PageManager::PAGE_BITS) + 1;
+    if (image.written_pages.size() + (end - begin) > num_pages / 4) {
+        // A large part of the image is being rewritten, so upload all of it instead of hashing.
+        image.flags |= ImageFlagBits::CpuDirty;
+        UntrackImage(image_id);
+        return;
+    }
+    for (u32 page = begin; page < end; page++) {
+        if (!image.untracked_pages.insert(page).second) {
+            continue;
+        }
+        // Faults are handled before the write, so the page still holds what was uploaded.
+        const auto [addr, size] = GetImagePageRange(image.info, page);
+        if (!image.written_pages.count(page)) {
+            image.written_pages.emplace(page, XXH3_64bits(std::bit_cast<const u8*>(addr), size));
+        }
         tracker.UpdatePageWatchers<false>(addr, size);
     }
 }
@@ -37,6 +37,8 @@ class TextureCache {
     static constexpr s64 TARGET_GC_THRESHOLD = 8_GB;
 
     using ImageIds = boost::container::small_vector<ImageId, 16>;
+    using ImageCopies = boost::container::small_vector<vk::BufferImageCopy, 14>;
+    using ImageRanges = boost::container::small_vector<std::pair<u32, u32>, 16>;
 
     struct Traits {
         using Entry = ImageIds;
@@ -278,9 +280,17 @@ private:
     void UntrackImage(ImageId image_id);
     void UntrackImageHead(ImageId image_id);
     void UntrackImageTail(ImageId image_id);
+    void UntrackImagePages(ImageId image_id, VAddr pages_start, VAddr pages_end);
 
     void MarkAsMaybeDirty(ImageId image_id, Image& image);
 
+    /// Collects uploads of every mip level, skipping unchanged levels of GPU modified images.
+    void CollectMipCopies(Image& image, ImageCopies& image_copies);
+
+    /// Collects uploads of the tile rows whose written pages changed since the last upload, and
+    /// the offset and size of each guest memory range they are read from.
+    void CollectWrittenRows(Image& image, ImageCopies& image_copies, ImageRanges& ranges);
+
     /// Removes the image and any views/surface metas that reference it.
     void DeleteImage(ImageId image_id);
 
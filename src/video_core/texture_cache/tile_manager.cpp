@@ -1,10 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2024 shadPS4 Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/div_ceil.h"
 #include "video_core/buffer_cache/buffer.h"
 #include "video_core/renderer_vulkan/vk_instance.h"
 #include "video_core/renderer_vulkan/vk_scheduler.h"
 #include "video_core/renderer_vulkan/vk_shader_util.h"
+#include "video_core/texture_cache/cpu_tiler.h"
 #include "video_core/texture_cache/image.h"
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view.h"
@@ -149,6 +151,7 @@ vk::Pipeline TileManager::GetTilingPipeline(const ImageInfo& info, bool is_tiler
         .pName = "main",
     };
     const vk::ComputePipelineCreateInfo compute_pipeline_ci = {
+        .flags = vk::PipelineCreateFlagBits::eDispatchBase,
         .stage = shader_ci,
         .layout = *pl_layout,
     };
@@ -162,7 +165,8 @@ vk::Pipeline TileManager::GetTilingPipeline(const ImageInfo& info, bool is_tiler
 }
 
 TileManager::Result TileManager::DetileImage(vk::Buffer in_buffer, u32 in_offset,
-                                             const ImageInfo& info) {
+                                             const ImageInfo& info,
+                                             std::span<const std::pair<u32, u32>> ranges) {
     if (!info.props.is_tiled) {
         return {in_buffer, in_offset};
     }
@@ -236,11 +240,36 @@ TileManager::Result TileManager::DetileImage(vk::Buffer in_buffer, u32 in_offset
     }};
     cmdbuf.pushDescriptorSetKHR(vk::PipelineBindPoint::eCompute, *pl_layout, 0, set_writes);
 
-    const auto dim_x = (info.guest_size / (info.num_bits / 8)) / 64;
-    cmdbuf.dispatch(dim_x, 1, 1);
+    const u32 bpp = info.num_bits / 8;
+    const u32 dim_x = (info.guest_size / bpp) / 64;
+    if (ranges.empty()) {
+        cmdbuf.dispatch(dim_x, 1, 1);
+        return {out_buffer, 0};
+    }
+    // Tile rows keep the same byte range in the tiled and linear data, so each range is detiled by
+    // the workgroups covering its texels.
+    for (const auto& [offset, size] : ranges) {
+        const u32 first_group = offset / bpp / 64;
+        const u32 end_group = std::min(Common::DivCeil((offset + size) / bpp, 64U), dim_x);
+        if (first_group < end_group) {
+            cmdbuf.dispatchBase(first_group, 0, 0, end_group - first_group, 1, 1);
+        }
+    }
     return {out_buffer, 0};
 }
 
+bool TileManager::CanDetileOnCpu(const ImageInfo& info) {
+    return info.guest_size <= MAX_CPU_DETILE_SIZE && CpuTiler::IsSupported(info);
+}
+
+TileManager::Result TileManager::DetileImageCpu(const u8* guest_data, const ImageInfo& info) {
+    const auto [data, offset] = stream_buffer.Map(info.guest_size, 16);
+    const CpuTiler tiler{info};
+    tiler.Detile({guest_data, info.guest_size}, {data, info.guest_size});
+    stream_buffer.Commit();
+    return {stream_buffer.Handle(), static_cast<u32>(offset)};
+}
+
 void TileManager::TileImage(Image& in_image, std::span<vk::BufferImageCopy> buffer_copies,
                             vk::Buffer out_buffer, u32 out_offset, u32 copy_size) {
     const auto& info = in_image.info;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <span>
 #include "common/types.h"
 #include "video_core/amdgpu/tiling.h"
 #include "video_core/buffer_cache/buffer.h"
@@ -15,6 +16,7 @@ class StreamBuffer;
 
 class TileManager {
     static constexpr size_t NUM_BPPS = 5;
+    static constexpr u32 MAX_CPU_DETILE_SIZE = 64_KB;
 
 public:
     using ScratchBuffer = std::pair<vk::Buffer, VmaAllocation>;
@@ -27,7 +29,16 @@ public:
     void TileImage(Image& in_image, std::span<vk::BufferImageCopy> buffer_copies,
                    vk::Buffer out_buffer, u32 out_offset, u32 copy_size);
 
-    Result DetileImage(vk::Buffer in_buffer, u32 in_offset, const ImageInfo& info);
+    /// Detiles the image on the GPU. When ranges of the tiled data are given as offset and size
+    /// pairs, only the texels stored in them are written to the output.
+    Result DetileImage(vk::Buffer in_buffer, u32 in_offset, const ImageInfo& info,
+                       std::span<const std::pair<u32, u32>> ranges = {});
+
+    /// Returns true if the image is small enough to be detiled on the host.
+    static bool CanDetileOnCpu(const ImageInfo& info);
+
+    /// Detiles guest image data on the host directly into the stream buffer.
+    Result DetileImageCpu(const u8* guest_data, const ImageInfo& info);
 
 private:
     vk::Pipeline GetTilingPipeline(const ImageInfo& info, bool is_tiler);